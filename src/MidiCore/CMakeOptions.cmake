@@ -3,7 +3,10 @@
     if(MIDILAR_FULL_BUILD)
         set(MIDILAR_MIDI_PROTOCOL ON)
         set(MIDILAR_MIDI_MESSAGE ON)
+        set(MIDILAR_MIDI_MESSAGE_BATCH ON)
+        set(MIDILAR_MIDI_FILE ON)
         set(MIDILAR_MIDI_MESSAGE_PARSER ON)
+        set(MIDILAR_MIDI_UMP ON)
         set(MIDILAR_MIDI_DEVICE_BASE ON)
     endif()
 #
@@ -17,15 +20,37 @@
 # Message
 
     option(MIDILAR_MIDI_MESSAGE "Enables the compilation of MIDILAR::MidiCore::Message" ON)
+    set(MIDILAR_MIDI_MESSAGE_INLINE_CAPACITY 8 CACHE STRING "Bytes a MIDILAR::MidiCore::Message stores inline before allocating")
+    option(MIDILAR_MIDI_MESSAGE_POOL "Allocates MIDILAR::MidiCore::Message heap storage from fixed-size block pools in builds without <vector>" OFF)
+    set(MIDILAR_MIDI_MESSAGE_POOL_BLOCKS_16 32 CACHE STRING "Number of 16 byte blocks in the MIDILAR::MidiCore::MessagePool")
+    set(MIDILAR_MIDI_MESSAGE_POOL_BLOCKS_64 16 CACHE STRING "Number of 64 byte blocks in the MIDILAR::MidiCore::MessagePool")
+    set(MIDILAR_MIDI_MESSAGE_POOL_BLOCKS_256 8 CACHE STRING "Number of 256 byte blocks in the MIDILAR::MidiCore::MessagePool")
+#
+##################################################################################################################################
+# Message Batch
+
+    option(MIDILAR_MIDI_MESSAGE_BATCH "Enables the compilation of MIDILAR::MidiCore::MessageBatch" ON)
+#
+##################################################################################################################################
+# MIDI File
+
+    option(MIDILAR_MIDI_FILE "Enables the compilation of the Standard MIDI File classes in MIDILAR::MidiCore" ON)
 #
 ##################################################################################################################################
 # Message Parser
 
     option(MIDILAR_MIDI_MESSAGE_PARSER "Enables the compilation of MIDILAR::MidiCore::MessageParser" ON)
+    option(MIDILAR_MIDI_MESSAGE_PARSER_STATISTICS "Counts processed bytes, messages, drops and overflows in MIDILAR::MidiCore::MessageParser" OFF)
+#
+##################################################################################################################################
+# Universal MIDI Packet
+
+    option(MIDILAR_MIDI_UMP "Enables the compilation of MIDILAR::MidiCore::UmpMessage and MIDILAR::MidiCore::UmpTranslator" ON)
 #
 ##################################################################################################################################
 # Device Base
 
     option(MIDILAR_MIDI_DEVICE_BASE "Enables the compilation of MIDILAR::MidiCore::DeviceBase" ON)
+    set(MIDILAR_MIDI_DEVICE_SYSEX_CHUNK_SIZE 64 CACHE STRING "Chunk size used by MIDILAR::MidiCore::DeviceBase to stream SysEx output")
 #
 #################################################################################################################################
@@ -52,6 +52,39 @@ namespace MIDILAR::MidiCore {
         MidiOutput(message.Buffer(), message.size());
     }
 
+    void DeviceBase::MidiOutputSysEx(const uint8_t* Payload, size_t Size) {
+        uint8_t chunk[MIDILAR_DEVICE_SYSEX_CHUNK_SIZE];
+        SysExWriter writer(chunk, sizeof(chunk));
+        writer.BindOutput<DeviceBase, &DeviceBase::_SysExChunkOutput>(this);
+        writer.Write(Payload, Size);
+    }
+
+    void DeviceBase::_SysExChunkOutput(const uint8_t* Data, size_t Size) {
+        MidiOutput(Data, Size);
+    }
+
+    void DeviceBase::MidiInput(const MidiCore::MessageView& View) {
+        MidiInput(View.Buffer(), View.size());
+    }
+
+    void DeviceBase::MidiOutput(const MidiCore::MessageView& View) {
+        MidiOutput(View.Buffer(), View.size());
+    }
+
+#if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+    void DeviceBase::MidiInput(const MidiCore::MessageBatch& Batch) {
+        for (const MidiCore::MessageView& message : Batch) {
+            MidiInput(message);
+        }
+    }
+
+    void DeviceBase::MidiOutput(const MidiCore::MessageBatch& Batch) {
+        for (const MidiCore::MessageView& message : Batch) {
+            MidiOutput(message);
+        }
+    }
+#endif
+
     void DeviceBase::Update(SystemCore::Clock::TimePoint SystemTime) {
         // Default implementation - derived classes can override
         (void)SystemTime; // Prevent unused parameter warning
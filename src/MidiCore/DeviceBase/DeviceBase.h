@@ -5,12 +5,28 @@
     #include <SystemCore/Clock/Clock.h>
     #include <SystemCore/CallbackHandler/CallbackHandler.h>
     #include <MidiCore/Message/Message.h>
+    #include <MidiCore/Message/MessageView.h>
+    #include <MidiCore/Message/SysExWriter.h>
     #include <stdint.h>
 
+    #if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+        #include <MidiCore/MessageBatch/MessageBatch.h>
+    #endif
+
     #if __has_include(<vector>)
         #include <vector>
     #endif
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief Size of the chunks `DeviceBase::MidiOutputSysEx` hands to the MIDI output callback.
+     *
+     * The chunk buffer lives on the stack for the duration of the call. Can be overridden at build time.
+     */
+    #ifndef MIDILAR_DEVICE_SYSEX_CHUNK_SIZE
+        #define MIDILAR_DEVICE_SYSEX_CHUNK_SIZE 64
+    #endif
+
     namespace MIDILAR::MidiCore {
 
         /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +141,20 @@
              * @param MidiOutHandler The callback function to handle MIDI output events.
              */
                 void BindMidiOut(MidiOut_CallbackType MidiOutHandler);
+
+            /**
+             * @brief Links an instance method as the MIDI output handler.
+             *
+             * Binding `SystemCore::CallbackList::invoke` sends the output to several targets at once.
+             *
+             * @tparam T Class type of the instance.
+             * @tparam Method Member function receiving the output bytes.
+             * @param instance Pointer to the instance that owns the method.
+             */
+                template <typename T, void (T::*Method)(const uint8_t*, size_t)>
+                void BindMidiOut(T* instance) {
+                    _MidiOutHandler.bind<T, Method>(instance);
+                }
             //
             /////////////////////////////////////////////////////////////////////////////////////////////
             /**
@@ -152,8 +182,22 @@
              * @param size Size of the MIDI message buffer.
              */
                 void MidiInput(const MidiCore::Message&);
+                void MidiInput(const MidiCore::MessageView& View); ///< Handles incoming MIDI input from a non-owning view.
                 virtual void MidiInput(const uint8_t* Data, size_t Size);
 
+                /////////////////////////////////////////////////////////////////////////////////////////
+                //
+                    #if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+                        /**
+                         * @brief Handles every message stored in a `MessageBatch`, one at a time.
+                         * 
+                         * @param Batch The batch of incoming messages.
+                         */
+                        void MidiInput(const MidiCore::MessageBatch& Batch);
+                    #endif
+                //
+                /////////////////////////////////////////////////////////////////////////////////////////
+
                 /////////////////////////////////////////////////////////////////////////////////////////
                 //
                     #if __has_include(<vector>)
@@ -208,8 +252,33 @@
              * @param size Size of the MIDI message buffer.
              */
                 void MidiOutput(const MidiCore::Message& message);
+                void MidiOutput(const MidiCore::MessageView& View); ///< Sends MIDI output from a non-owning view.
                 void MidiOutput(const uint8_t* Data, size_t Size);
 
+                /**
+                 * @brief Sends a System Exclusive message in chunks of `MIDILAR_DEVICE_SYSEX_CHUNK_SIZE` bytes.
+                 * 
+                 * The payload is framed with 0xF0 and 0xF7 while streaming, so the complete message is never
+                 * built in memory. Each chunk is delivered through the MIDI output callback.
+                 * 
+                 * @param Payload Pointer to the SysEx payload, without the framing bytes.
+                 * @param Size Size of the payload in bytes.
+                 */
+                void MidiOutputSysEx(const uint8_t* Payload, size_t Size);
+
+                /////////////////////////////////////////////////////////////////////////////////////////
+                //
+                    #if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+                        /**
+                         * @brief Sends every message stored in a `MessageBatch`, one callback per message.
+                         * 
+                         * @param Batch The batch of outgoing messages.
+                         */
+                        void MidiOutput(const MidiCore::MessageBatch& Batch);
+                    #endif
+                //
+                /////////////////////////////////////////////////////////////////////////////////////////
+
                 /////////////////////////////////////////////////////////////////////////////////////////
                 //
                     #if __has_include(<vector>)
@@ -227,7 +296,8 @@
             /////////////////////////////////////////////////////////////////////////////////////////////
 
         private:
-            
+
+            void _SysExChunkOutput(const uint8_t* Data, size_t Size); ///< Forwards a SysEx chunk to `MidiOutput`.
 
         };
 
@@ -6,6 +6,10 @@
     #if __has_include(<MidiCore/Message/Message.h>)
         #define MIDILAR_MIDI_MESSAGE
         #include <MidiCore/Message/Message.h>
+        #include <MidiCore/Message/ShortMessage.h>
+        #include <MidiCore/Message/MessageView.h>
+        #include <MidiCore/Message/ParameterNumberEncoder.h>
+        #include <MidiCore/Message/SysExWriter.h>
     #endif
 
 #endif//MIDILAR_MIDI_MESSAGE_H
\ No newline at end of file
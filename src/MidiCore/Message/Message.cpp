@@ -1,18 +1,42 @@
 #include "Message.h"
+#include "ParameterNumberEncoder.h"
+#include <MidiCore/Protocol/SysExCodec.h>
 
 namespace MIDILAR::MidiCore{
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Private resize method
+    // Private storage methods
+
+        uint8_t* Message::_buffer() {
+            #if __has_include(<vector>)
+                return (_Data.capacity() > 0) ? _Data.data() : _Inline;
+            #else
+                return (_Data != nullptr) ? _Data : _Inline;
+            #endif
+        }
+
+        const uint8_t* Message::_buffer() const {
+            #if __has_include(<vector>)
+                return (_Data.capacity() > 0) ? _Data.data() : _Inline;
+            #else
+                return (_Data != nullptr) ? _Data : _Inline;
+            #endif
+        }
 
         bool Message::_resize(size_t new_size) {
             #if __has_include(<vector>)
-                if (new_size <= _Data.size()) {
-                    _Data.resize(new_size);
-                    return true; // No need to resize if the current size is already sufficient
+                if (_Data.capacity() == 0 && new_size <= InlineCapacity) {
+                    _MessageSize = new_size;
+                    return true; // Fits in the inline storage
                 }
 
                 try {
+                    if (_Data.capacity() == 0) {
+                        // Spill the inline bytes to the heap before growing
+                        _Data.reserve(new_size);
+                        _Data.assign(_Inline, _Inline + _MessageSize);
+                        _MessageSize = 0;
+                    }
                     _Data.resize(new_size);
                     return true; // Resizing successful
                 } catch (const std::bad_alloc&) {
@@ -20,142 +44,134 @@ namespace MIDILAR::MidiCore{
                 }
                 
             #else
-                if (new_size <= _BufferSize) {
+                size_t capacity = (_Data != nullptr) ? _BufferSize : InlineCapacity;
+                if (new_size <= capacity) {
                     _MessageSize = new_size;
                     return true; // No need to resize if the current size is already sufficient
                 }
 
-                uint8_t* new_data = (uint8_t*)calloc(new_size, sizeof(uint8_t));
+                // Grow geometrically so chunked appends stay linear
+                size_t new_capacity = (new_size > capacity * 2) ? new_size : capacity * 2;
+
+                uint8_t* new_data = _allocate(new_capacity, new_capacity);
                 if (new_data == nullptr) {
                     return false; // Memory allocation failed
                 }
 
-                // Copy existing data to the newly allocated memory, if applicable
-                if (_Data != nullptr) {
-                    size_t copy_size = (_BufferSize < new_size) ? _BufferSize : new_size;
-                    for (size_t i = 0; i < copy_size; ++i) {
-                        new_data[i] = _Data[i];
-                    }
-                    free(_Data); // Release the old memory
-                }
+                // Copy existing data to the newly allocated memory
+                memcpy(new_data, _buffer(), _MessageSize);
+                _release(); // Release the old memory
 
                 _Data = new_data;
-                _BufferSize = new_size;
+                _BufferSize = new_capacity;
                 _MessageSize = new_size;
                 return true; // Successful resize
             #endif
         }
-    //
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Constructors and Assignment Operators
 
-        Message::Message() noexcept{
-            #if __has_include(<vector>)
-                // std::vector is automatically initialized
-            #else
-                _Data = nullptr;
-                _BufferSize = 0;
-                _MessageSize = 0;
-            #endif
-        }
+        #if !__has_include(<vector>)
+            uint8_t* Message::_allocate(size_t Size, size_t& Capacity) {
+                #if defined(MIDILAR_MESSAGE_POOL)
+                    uint8_t* block = MessagePool::Allocate(Size, Capacity);
+                    if (block != nullptr) {
+                        memset(block, 0, Capacity);
+                        return block;
+                    }
+                    MessagePool::CountHeapAllocation();
+                #endif
 
-        Message::Message(const Message& MessageBuffer) {
-            #if __has_include(<vector>)
-                // For vector, we just copy the vector data
-                _Data = MessageBuffer._Data;  // This works because std::vector handles its own memory management
-            #else
-                // Resize the buffer to accommodate the new message size
-                if (!_resize(MessageBuffer._MessageSize)) {
-                    // If resizing fails, handle the failure (e.g., throw an exception, or set a failure flag)
+                Capacity = Size;
+                return (uint8_t*)calloc(Size, sizeof(uint8_t));
+            }
+
+            void Message::_release() {
+                if (_Data == nullptr) {
                     return;
                 }
 
-                _BufferSize = MessageBuffer._MessageSize;
-                _MessageSize = MessageBuffer._MessageSize;
+                #if defined(MIDILAR_MESSAGE_POOL)
+                    if (!MessagePool::Deallocate(_Data)) {
+                        free(_Data);
+                    }
+                #else
+                    free(_Data);
+                #endif
+                _Data = nullptr;
+            }
+        #endif
 
-                // Copy the data byte by byte
-                for (size_t i = 0; i < _MessageSize; ++i) {
-                    _Data[i] = MessageBuffer._Data[i];
+        #if __has_include(<vector>)
+            void Message::_promote() const {
+                if (_Data.capacity() == 0) {
+                    _Data.reserve(InlineCapacity);
+                    _Data.assign(_Inline, _Inline + _MessageSize);
                 }
+            }
+        #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors and Assignment Operators
+
+        Message::Message() noexcept
+            : _MessageSize(0)
+        {
+            #if !__has_include(<vector>)
+                _Data = nullptr;
+                _BufferSize = 0;
             #endif
         }
 
-        Message::Message(Message&& MessageBuffer) noexcept {
-            #if __has_include(<vector>)
-                // For vector, the move constructor is automatically handled by std::vector
-                _Data = std::move(MessageBuffer._Data);  // std::move transfers ownership of the vector
-            #else
-                // Move the data pointer and update size variables
-                _Data = MessageBuffer._Data;  // Take ownership of the existing buffer
-                _BufferSize = MessageBuffer._BufferSize;
-                _MessageSize = MessageBuffer._MessageSize;
-
-                // Leave the source object in a valid state (set it to default or null)
-                MessageBuffer._Data = nullptr;
-                MessageBuffer._BufferSize = 0;
-                MessageBuffer._MessageSize = 0;
-            #endif
+        Message::Message(const Message& MessageBuffer)
+            : Message()
+        {
+            SetRawData(MessageBuffer.Buffer(), MessageBuffer.size());
         }
 
-        Message::Message(uint8_t* Buffer, uint8_t size) {
-            #if __has_include(<vector>)
-                // If std::vector is available, we can use it directly
-                _Data = std::vector<uint8_t>(Buffer, Buffer + size);  // Copy the buffer into the vector
-            #else
-                // If std::vector is not available, we allocate memory and copy the data manually
-                _BufferSize = size;
-                _MessageSize = size;
+        Message::Message(Message&& MessageBuffer) noexcept
+            : Message()
+        {
+            *this = static_cast<Message&&>(MessageBuffer);
+        }
 
-                // Allocate memory for the data
-                _Data = (uint8_t*)calloc(size, sizeof(uint8_t));
-                if (_Data == nullptr) {
-                    // Handle allocation failure (return or throw exception, depending on your design)
-                    return;
-                }
+        Message::Message(uint8_t* Buffer, uint8_t size)
+            : Message()
+        {
+            SetRawData(Buffer, size);
+        }
 
-                // Copy the data from the provided buffer
-                for (uint8_t i = 0; i < size; ++i) {
-                    _Data[i] = Buffer[i];
-                }
+        Message::~Message() {
+            #if !__has_include(<vector>)
+                _release();
             #endif
         }
 
         Message& Message::operator=(const Message& Source) {
-            #if __has_include(<vector>)
-                // If using std::vector, directly copy the data from Source
-                _Data = Source._Data;
-            #else
-                // If not using std::vector, we need to handle raw memory
-                if (this != &Source) {
-                    // Resize the buffer if necessary
-                    if (!_resize(Source._MessageSize)) {
-                        return *this; // Handle failure by returning the current object
-                    }
-
-                    _BufferSize = Source._MessageSize;
-                    _MessageSize = Source._MessageSize;
-
-                    // Copy data byte by byte
-                    for (size_t i = 0; i < _MessageSize; ++i) {
-                        _Data[i] = Source._Data[i];
-                    }
-                }
-            #endif
-
+            if (this != &Source) {
+                SetRawData(Source.Buffer(), Source.size());
+            }
             return *this;
         }
     
         Message& Message::operator=(Message&& Source) noexcept {
+            if (this == &Source) {
+                return *this;
+            }
+
             #if __has_include(<vector>)
-                // If using std::vector, move the data from Source
-                _Data = std::move(Source._Data);
+                if (Source._Data.capacity() > 0) {
+                    // Take ownership of the heap storage and leave Source empty and inline
+                    _Data = std::move(Source._Data);
+                    std::vector<uint8_t>().swap(Source._Data);
+                    _MessageSize = 0;
+                } else {
+                    // Inline messages are copied, reusing any heap storage already owned
+                    _resize(Source._MessageSize);
+                    memcpy(_buffer(), Source._Inline, Source._MessageSize);
+                }
             #else
-                // If not using std::vector, handle raw memory
-                if (this != &Source) {
+                if (Source._Data != nullptr) {
                     // Free any existing data before moving
-                    if (_Data != nullptr) {
-                        free(_Data);
-                    }
+                    _release();
 
                     // Move the raw buffer and metadata
                     _Data = Source._Data;
@@ -165,10 +181,13 @@ namespace MIDILAR::MidiCore{
                     // Nullify Source's data to prevent double-free
                     Source._Data = nullptr;
                     Source._BufferSize = 0;
-                    Source._MessageSize = 0;
+                } else {
+                    _resize(Source._MessageSize);
+                    memcpy(_buffer(), Source._Inline, Source._MessageSize);
                 }
             #endif
 
+            Source._MessageSize = 0;
             return *this;
         }
 
@@ -177,26 +196,29 @@ namespace MIDILAR::MidiCore{
             
             #if __has_include(<vector>)
                 // Copy constructor for std::vector
-                Message::Message(const std::vector<uint8_t>& MessageBuffer) {
-                    // Directly copy the data from the vector
-                    _Data = MessageBuffer;
+                Message::Message(const std::vector<uint8_t>& MessageBuffer)
+                    : Message()
+                {
+                    SetRawData(MessageBuffer);
                 }
 
                 // Move constructor for std::vector
-                Message::Message(std::vector<uint8_t>&& MessageBuffer) noexcept {
-                    // Move the data from the vector
-                    _Data = std::move(MessageBuffer);
+                Message::Message(std::vector<uint8_t>&& MessageBuffer) noexcept
+                    : Message()
+                {
+                    *this = std::move(MessageBuffer);
                 }
             
                 // Copy assignment operator for std::vector
                 Message& Message::operator=(const std::vector<uint8_t>& MessageBuffer) {
-                    _Data = MessageBuffer;  // Simply copy the vector
-                    return *this;
+                    return SetRawData(MessageBuffer);
                 }
 
                 // Move assignment operator for std::vector
                 Message& Message::operator=(std::vector<uint8_t>&& MessageBuffer) noexcept {
-                    _Data = std::move(MessageBuffer);  // Move the vector
+                    // Adopt the vector's storage as heap storage, no copy is made
+                    _Data = std::move(MessageBuffer);
+                    _MessageSize = 0;
                     return *this;
                 }
             #endif
@@ -207,55 +229,95 @@ namespace MIDILAR::MidiCore{
     // Data Access
 
         const uint8_t* Message::Buffer() const {
-            #if __has_include(<vector>)
-                return _Data.empty() ? nullptr : _Data.data();
-            #else
-                return (_Data && _MessageSize > 0) ? _Data : nullptr;
-            #endif
+            return (size() > 0) ? _buffer() : nullptr;
         }
 
         uint8_t Message::Data(size_t index) const {
             if (index < size()) {
-                #if __has_include(<vector>)
-                    return _Data[index];
-                #else
-                    return (_Data ? _Data[index] : 0);
-                #endif
+                return _buffer()[index];
             }
             return 0; // Out-of-bounds access returns 0
         }
         
         size_t Message::size() const{
-            
             #if __has_include(<vector>)
-                return _Data.size();
+                return (_Data.capacity() > 0) ? _Data.size() : _MessageSize;
             #else
                 return _MessageSize;
             #endif
         }
 
+        bool Message::IsInline() const {
+            #if __has_include(<vector>)
+                return _Data.capacity() == 0;
+            #else
+                return _Data == nullptr;
+            #endif
+        }
+
         Message& Message::SetRawData(const uint8_t* Data, size_t Size) {
             if (!Data || Size == 0) {
                 _resize(0);
                 return *this;
             }
 
+            if (Data == _buffer()) {
+                _resize(Size);
+                return *this; // Avoid unnecessary self-assignment
+            }
+
+            if (!_resize(Size)) {
+                _resize(0);
+                return *this;
+            }
+            memcpy(_buffer(), Data, Size);
+
+            return *this;
+        }
+
+        Message& Message::Append(const uint8_t* Data, size_t Size) {
+            if (!Data || Size == 0) {
+                return *this; // No data to append
+            }
+
+            size_t offset = size();
+            if (_resize(offset + Size)) {
+                memcpy(_buffer() + offset, Data, Size);
+            }
+            return *this;
+        }
+
+        bool Message::Reserve(size_t Capacity) {
             #if __has_include(<vector>)
-                if (Data == _Data.data()){ return *this; } // Avoid unnecessary self-assignment
-                _Data.assign(Data, Data + Size);
+                if (_Data.capacity() == 0 && Capacity <= InlineCapacity) {
+                    return true; // Fits in the inline storage
+                }
+
+                try {
+                    _promote();
+                    _Data.reserve(Capacity);
+                    return true;
+                } catch (const std::bad_alloc&) {
+                    return false; // Allocation failed
+                }
             #else
-                if (Data == _Data) return; // Avoid self-assignment
-                if (Size > _BufferSize) {
-                    if (!_resize(Size)) {
-                        _resize(0);
-                        return *this;
-                    }
+                size_t capacity = (_Data != nullptr) ? _BufferSize : InlineCapacity;
+                if (Capacity <= capacity) {
+                    return true; // Already large enough
                 }
-                memcpy(_Data, Data, Size);
-                _MessageSize = Size;
-            #endif
 
-            return *this;
+                uint8_t* new_data = _allocate(Capacity, Capacity);
+                if (new_data == nullptr) {
+                    return false; // Memory allocation failed
+                }
+
+                memcpy(new_data, _buffer(), _MessageSize);
+                _release();
+
+                _Data = new_data;
+                _BufferSize = Capacity;
+                return true;
+            #endif
         }
 
 
@@ -276,31 +338,35 @@ namespace MIDILAR::MidiCore{
 
             // Getter for the internal buffer as a constant reference to std::vector
             const std::vector<uint8_t>& Message::Vector() const {
+                _promote();
                 return _Data;  // Return the internal vector
             }
 
             // Iterator to the beginning of the buffer (non-const)
             std::vector<uint8_t>::iterator Message::begin() noexcept {
+                _promote();
                 return _Data.begin();  // Return an iterator to the beginning
             }
 
             // Constant iterator to the beginning of the buffer
             std::vector<uint8_t>::const_iterator Message::cbegin() const noexcept {
+                _promote();
                 return _Data.cbegin();  // Return a constant iterator to the beginning
             }
 
             // Iterator to the end of the buffer (non-const)
             std::vector<uint8_t>::iterator Message::end() noexcept {
+                _promote();
                 return _Data.end();  // Return an iterator to the end
             }
 
             // Constant iterator to the end of the buffer
             std::vector<uint8_t>::const_iterator Message::cend() const noexcept {
+                _promote();
                 return _Data.cend();  // Return a constant iterator to the end
             }
 
         #endif // __has_include(<vector>)
-    //
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Channel Voice
 
@@ -311,9 +377,9 @@ namespace MIDILAR::MidiCore{
                 // Resize the buffer to accommodate the message (3 bytes: command, pitch, velocity)
                 if (_resize(3)) {
                     // Set the Note Off command (0x80), with the specified channel
-                    _Data[0] = MIDI_NOTE_OFF + ((Channel<15)?Channel:15);  // 0x80 is the Note Off command, and Channel is masked to 4 bits
-                    _Data[1] = (Pitch<127)?Pitch:127;                    // Pitch value (which note to turn off)
-                    _Data[2] = (Vel<127)?Vel:127;                        // Velocity value (optional, can be 0)
+                    _buffer()[0] = MIDI_NOTE_OFF + ((Channel<15)?Channel:15);  // 0x80 is the Note Off command, and Channel is masked to 4 bits
+                    _buffer()[1] = (Pitch<127)?Pitch:127;                    // Pitch value (which note to turn off)
+                    _buffer()[2] = (Vel<127)?Vel:127;                        // Velocity value (optional, can be 0)
                 }
 
                 return *this;
@@ -323,9 +389,9 @@ namespace MIDILAR::MidiCore{
                 // Resize the buffer to accommodate the message (3 bytes: command, pitch, velocity)
                 if (_resize(3)) {
                     // Set the Note On command (0x90), with the specified channel
-                    _Data[0] = MIDI_NOTE_ON + ((Channel<15)?Channel:15);  // 0x90 is the Note On command, and Channel is masked to 4 bits
-                    _Data[1] = (Pitch<127)?Pitch:127;                    // Pitch value (which note to turn off)
-                    _Data[2] = (Vel<127)?Vel:127;                        // Velocity value (optional, can be 0)
+                    _buffer()[0] = MIDI_NOTE_ON + ((Channel<15)?Channel:15);  // 0x90 is the Note On command, and Channel is masked to 4 bits
+                    _buffer()[1] = (Pitch<127)?Pitch:127;                    // Pitch value (which note to turn off)
+                    _buffer()[2] = (Vel<127)?Vel:127;                        // Velocity value (optional, can be 0)
                 }
 
                 return *this;
@@ -337,9 +403,9 @@ namespace MIDILAR::MidiCore{
             Message& Message::AfterTouch(uint8_t Pitch, uint8_t Pressure, uint8_t Channel) {
                 // Resize the buffer to accommodate the message (3 bytes: command, Pitch, pressure)
                 if (_resize(3)) {
-                    _Data[0] = MIDI_AFTER_TOUCH + ((Channel<15)?Channel:15);  // AfterTouch command, and Channel is masked to 4 bits
-                    _Data[1] = (Pitch<127)?Pitch:127;                         // Pitch value
-                    _Data[2] = (Pressure<127)?Pressure:127;                   // Pressure Value
+                    _buffer()[0] = MIDI_AFTER_TOUCH + ((Channel<15)?Channel:15);  // AfterTouch command, and Channel is masked to 4 bits
+                    _buffer()[1] = (Pitch<127)?Pitch:127;                         // Pitch value
+                    _buffer()[2] = (Pressure<127)?Pressure:127;                   // Pressure Value
                 }
 
                 return *this;
@@ -351,9 +417,9 @@ namespace MIDILAR::MidiCore{
             Message& Message::ControlChange(uint8_t ControllerNumber, uint8_t Value, uint8_t Channel) {
                 // Resize the buffer to accommodate the message (3 bytes: command, controller number, value)
                 if (_resize(3)) {
-                    _Data[0] = MIDI_CONTROL_CHANGE + ((Channel<15)?Channel:15);  // AfterTouch command, and Channel is masked to 4 bits
-                    _Data[1] = (ControllerNumber<127)?ControllerNumber:127;   // Pitch value
-                    _Data[2] = (Value<127)?Value:127;                         // Pressure Value
+                    _buffer()[0] = MIDI_CONTROL_CHANGE + ((Channel<15)?Channel:15);  // AfterTouch command, and Channel is masked to 4 bits
+                    _buffer()[1] = (ControllerNumber<127)?ControllerNumber:127;   // Pitch value
+                    _buffer()[2] = (Value<127)?Value:127;                         // Pressure Value
                 }
 
                 return *this;
@@ -517,24 +583,36 @@ namespace MIDILAR::MidiCore{
                 /////////////////////////////////////////////////////////////////////////////////////////////////////
                 // RPN & NRPN Messages
 
-                    Message& Message::CC_NRPN(uint16_t ParameterID, uint8_t Data){
-
-                        return *this;
+                    Message& Message::CC_NRPN(uint16_t ParameterID, uint8_t Data, uint8_t Channel){
+                        uint8_t sequence[ParameterNumberEncoder::MaxSize];
+                        size_t size = ParameterNumberEncoder::Write(sequence, ParameterNumberEncoder::Type::NRPN, ParameterID, Data, false, Channel);
+                        return SetRawData(sequence, size);
                     }
 
-                    Message& Message::CC_NRPN(uint16_t ParameterID, uint16_t Data){
-
-                        return *this;
+                    Message& Message::CC_NRPN(uint16_t ParameterID, uint16_t Data, uint8_t Channel){
+                        uint8_t sequence[ParameterNumberEncoder::MaxSize];
+                        size_t size = ParameterNumberEncoder::Write(sequence, ParameterNumberEncoder::Type::NRPN, ParameterID, Data, true, Channel);
+                        return SetRawData(sequence, size);
                     }
 
-                    Message& Message::CC_NRPN_DataIncrement(){
+                    Message& Message::CC_RPN(uint16_t ParameterID, uint8_t Data, uint8_t Channel){
+                        uint8_t sequence[ParameterNumberEncoder::MaxSize];
+                        size_t size = ParameterNumberEncoder::Write(sequence, ParameterNumberEncoder::Type::RPN, ParameterID, Data, false, Channel);
+                        return SetRawData(sequence, size);
+                    }
 
-                        return *this;
+                    Message& Message::CC_RPN(uint16_t ParameterID, uint16_t Data, uint8_t Channel){
+                        uint8_t sequence[ParameterNumberEncoder::MaxSize];
+                        size_t size = ParameterNumberEncoder::Write(sequence, ParameterNumberEncoder::Type::RPN, ParameterID, Data, true, Channel);
+                        return SetRawData(sequence, size);
                     }
 
-                    Message& Message::CC_NRPN_DataDecrement(){
+                    Message& Message::CC_NRPN_DataIncrement(uint8_t Channel){
+                        return ControlChange(MIDI_NRPN_DATA_INCREMENT, 0x00, Channel);
+                    }
 
-                        return *this;
+                    Message& Message::CC_NRPN_DataDecrement(uint8_t Channel){
+                        return ControlChange(MIDI_NRPN_DATA_DECREMENT, 0x00, Channel);
                     }
                 //
                 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,8 +626,8 @@ namespace MIDILAR::MidiCore{
 
                 // Resize the buffer to accommodate the message (2 bytes: command, program number)
                 if (_resize(2)) {
-                    _Data[0] = MIDI_PROGRAM_CHANGE + ((Channel<15)?Channel:15);  // 0xC0 is the Program Change command, and Channel is masked to 4 bits
-                    _Data[1] = (Program<127)?Program:127;;                  // The program change number
+                    _buffer()[0] = MIDI_PROGRAM_CHANGE + ((Channel<15)?Channel:15);  // 0xC0 is the Program Change command, and Channel is masked to 4 bits
+                    _buffer()[1] = (Program<127)?Program:127;;                  // The program change number
                 }
 
                 return *this;
@@ -568,8 +646,8 @@ namespace MIDILAR::MidiCore{
                     uint8_t clampedPressure = (Pressure < 127) ? Pressure : 127;
 
                     // Populate the buffer
-                    _Data[0] = MIDI_CHANNEL_PRESSURE + clampedChannel; // 0xD0 + channel
-                    _Data[1] = clampedPressure;                       // Pressure value
+                    _buffer()[0] = MIDI_CHANNEL_PRESSURE + clampedChannel; // 0xD0 + channel
+                    _buffer()[1] = clampedPressure;                       // Pressure value
                 }
 
                 return *this;
@@ -587,9 +665,9 @@ namespace MIDILAR::MidiCore{
                 uint16_t val = (Value >= 0) ? (midpoint + ValueScaled) : (midpoint - ValueScaled);
 
                 if (_resize(3)) {
-                    _Data[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // Set the command and channel
-                    _Data[1] = (val & 0x7F);           // Extract the 7-bit LSB
-                    _Data[2] = ((val >> 7) & 0x7F);    // Extract the 7-bit MSB
+                    _buffer()[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // Set the command and channel
+                    _buffer()[1] = (val & 0x7F);           // Extract the 7-bit LSB
+                    _buffer()[2] = ((val >> 7) & 0x7F);    // Extract the 7-bit MSB
                 }
 
                 return *this;
@@ -610,11 +688,11 @@ namespace MIDILAR::MidiCore{
 
                 if (_resize(3)) {
                     // Set command and clamp the channel to the valid range [0, 15]
-                    _Data[0] = MIDI_PITCH_BEND + ((Channel < 16) ? Channel : 15);
+                    _buffer()[0] = MIDI_PITCH_BEND + ((Channel < 16) ? Channel : 15);
 
                     // Extract the 7-bit LSB and MSB from the 14-bit value
-                    _Data[1] = static_cast<uint8_t>(val & 0x7F);        // LSB
-                    _Data[2] = static_cast<uint8_t>((val >> 7) & 0x7F); // MSB
+                    _buffer()[1] = static_cast<uint8_t>(val & 0x7F);        // LSB
+                    _buffer()[2] = static_cast<uint8_t>((val >> 7) & 0x7F); // MSB
                 }
 
                 return *this;
@@ -625,9 +703,9 @@ namespace MIDILAR::MidiCore{
                 uint16_t ValueMapped = ((uint16_t)Value<<6);
 
                 if (_resize(3)) {
-                    _Data[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // 0xE0 is the Pitch Bend command, and Channel is masked to 4 bits
-                    _Data[1] = (ValueMapped & 0x7F);           // 7-bit LSB (Least Significant Byte)
-                    _Data[2] = ((ValueMapped >> 7) & 0x7F);    // 7-bit MSB (Most Significant Byte)
+                    _buffer()[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // 0xE0 is the Pitch Bend command, and Channel is masked to 4 bits
+                    _buffer()[1] = (ValueMapped & 0x7F);           // 7-bit LSB (Least Significant Byte)
+                    _buffer()[2] = ((ValueMapped >> 7) & 0x7F);    // 7-bit MSB (Most Significant Byte)
                 }
 
                 return *this;
@@ -640,9 +718,9 @@ namespace MIDILAR::MidiCore{
                 }
 
                 if (_resize(3)) {
-                    _Data[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // 0xE0 is the Pitch Bend command, and Channel is masked to 4 bits
-                    _Data[1] = (Value & 0x7F);           // 7-bit LSB (Least Significant Byte)
-                    _Data[2] = ((Value >> 7) & 0x7F);    // 7-bit MSB (Most Significant Byte)
+                    _buffer()[0] = MIDI_PITCH_BEND + ((Channel<15)?Channel:15);  // 0xE0 is the Pitch Bend command, and Channel is masked to 4 bits
+                    _buffer()[1] = (Value & 0x7F);           // 7-bit LSB (Least Significant Byte)
+                    _buffer()[2] = ((Value >> 7) & 0x7F);    // 7-bit MSB (Most Significant Byte)
                 }
 
                 return *this;
@@ -659,9 +737,9 @@ namespace MIDILAR::MidiCore{
 
                 // Resize the buffer to accommodate the message (3 bytes)
                 if (_resize(3)) {
-                    _Data[0] = 0x80 + Channel;  // 0x80 is the Note Off command, and Channel is masked to 4 bits
-                    _Data[1] = pitch;                    // Pitch value
-                    _Data[2] = velocity;                  // Velocity value
+                    _buffer()[0] = 0x80 + Channel;  // 0x80 is the Note Off command, and Channel is masked to 4 bits
+                    _buffer()[1] = pitch;                    // Pitch value
+                    _buffer()[2] = velocity;                  // Velocity value
                 }
 
                 return *this;
@@ -675,9 +753,9 @@ namespace MIDILAR::MidiCore{
 
                 // Resize the buffer to accommodate the message (3 bytes)
                 if (_resize(3)) {
-                    _Data[0] = 0x90 + Channel;  // 0x90 is the Note On command, and Channel is masked to 4 bits
-                    _Data[1] = pitch;                    // Pitch value
-                    _Data[2] = velocity;                  // Velocity value
+                    _buffer()[0] = 0x90 + Channel;  // 0x90 is the Note On command, and Channel is masked to 4 bits
+                    _buffer()[1] = pitch;                    // Pitch value
+                    _buffer()[2] = velocity;                  // Velocity value
                 }
 
                 return *this;
@@ -689,42 +767,42 @@ namespace MIDILAR::MidiCore{
         
         Message& Message::TimingTick(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_TIMING_TICK;
+                _buffer()[0] = MIDI_REALTIME_TIMING_TICK;
             }
             return *this;
         }
 
         Message& Message::Start(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_START;
+                _buffer()[0] = MIDI_REALTIME_START;
             }
             return *this;
         }
 
         Message& Message::Continue(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_CONTINUE;
+                _buffer()[0] = MIDI_REALTIME_CONTINUE;
             }
             return *this;
         }
 
         Message& Message::Stop(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_STOP;
+                _buffer()[0] = MIDI_REALTIME_STOP;
             }
             return *this;
         }
 
         Message& Message::ActiveSensing(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_ACTIVE_SENSING;
+                _buffer()[0] = MIDI_REALTIME_ACTIVE_SENSING;
             }
             return *this;
         }
 
         Message& Message::SystemReset(){
             if (_resize(1)) {
-                _Data[0] = MIDI_REALTIME_SYSTEM_RESET;
+                _buffer()[0] = MIDI_REALTIME_SYSTEM_RESET;
             }
             return *this;
         }
@@ -737,8 +815,8 @@ namespace MIDILAR::MidiCore{
 
             Message& Message::MTC_QuarterFrame(uint8_t TimeComponent, uint8_t Data) {
                 if (_resize(2)) {
-                    _Data[0] = MIDI_MTC_QUARTER_FRAME;
-                    _Data[1] = ((TimeComponent & 0x07) << 4) | (Data & 0x0F);
+                    _buffer()[0] = MIDI_MTC_QUARTER_FRAME;
+                    _buffer()[1] = ((TimeComponent & 0x07) << 4) | (Data & 0x0F);
                 }
                 return *this;
             }
@@ -750,14 +828,14 @@ namespace MIDILAR::MidiCore{
 
             Message& Message::MTC_FullFrame(uint8_t Hours, uint8_t Minutes, uint8_t Seconds, uint8_t Frames, uint8_t Framerate, uint8_t SysexChannel) {
                 if (_resize(8)) {
-                    _Data[0] = MIDI_SYSEX_START;                 // Start of SysEx
-                    _Data[2] = MIDI_SYSEX_RT_MTC_FULL_FRAME;  // Full Frame identifier
-                    _Data[1] = SysexChannel;         // SysEx Channel
-                    _Data[3] = ((Framerate & 0x03) << 5) | (Hours & 0x1F); // Framerate + Hours
-                    _Data[4] = Minutes & 0x3F;       // Minutes
-                    _Data[5] = Seconds & 0x3F;       // Seconds
-                    _Data[6] = Frames & 0x1F;        // Frames
-                    _Data[7] = MIDI_SYSEX_END;                 // End of SysEx
+                    _buffer()[0] = MIDI_SYSEX_START;                 // Start of SysEx
+                    _buffer()[2] = MIDI_SYSEX_RT_MTC_FULL_FRAME;  // Full Frame identifier
+                    _buffer()[1] = SysexChannel;         // SysEx Channel
+                    _buffer()[3] = ((Framerate & 0x03) << 5) | (Hours & 0x1F); // Framerate + Hours
+                    _buffer()[4] = Minutes & 0x3F;       // Minutes
+                    _buffer()[5] = Seconds & 0x3F;       // Seconds
+                    _buffer()[6] = Frames & 0x1F;        // Frames
+                    _buffer()[7] = MIDI_SYSEX_END;                 // End of SysEx
                 }
                 return *this;
             }
@@ -771,9 +849,9 @@ namespace MIDILAR::MidiCore{
         
             Message& Message::SongPositionPointer(uint16_t Position) {
                 if (_resize(3)) {
-                    _Data[0] = MIDI_SONG_POSITION_POINTER; // Song Position Pointer status byte
-                    _Data[1] = Position & 0x7F;           // Least significant 7 bits
-                    _Data[2] = (Position >> 7) & 0x7F;    // Most significant 7 bits
+                    _buffer()[0] = MIDI_SONG_POSITION_POINTER; // Song Position Pointer status byte
+                    _buffer()[1] = Position & 0x7F;           // Least significant 7 bits
+                    _buffer()[2] = (Position >> 7) & 0x7F;    // Most significant 7 bits
                 }
                 return *this;
             }
@@ -783,8 +861,8 @@ namespace MIDILAR::MidiCore{
 
             Message& Message::SongSelect(uint8_t Song) {
                 if (_resize(2)) {
-                    _Data[0] = MIDI_SONG_SELECT; // Song Select status byte
-                    _Data[1] = Song & 0x7F;      // Ensure only the lower 7 bits are used
+                    _buffer()[0] = MIDI_SONG_SELECT; // Song Select status byte
+                    _buffer()[1] = Song & 0x7F;      // Ensure only the lower 7 bits are used
                 }
                 return *this;
             }
@@ -794,16 +872,16 @@ namespace MIDILAR::MidiCore{
 
             Message& Message::TuningRequest() {
                 if (_resize(1)) {
-                    _Data[0] = MIDI_TUNING_REQUEST; // Tuning Request status byte
+                    _buffer()[0] = MIDI_TUNING_REQUEST; // Tuning Request status byte
                 }
                 return *this;
             }
         //
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Message& Message::SystemExclusive(const uint8_t* Data, uint8_t Length) {
+        Message& Message::SystemExclusive(const uint8_t* Data, size_t Length) {
             // Validate input
-            if (Length == 0) {
+            if (Data == nullptr || Length == 0) {
                 return *this;  // No data to process
             }
 
@@ -821,18 +899,17 @@ namespace MIDILAR::MidiCore{
 
             // **Add SysEx Start (0xF0) if missing**
             if (Data[0] != 0xF0) {
-                _Data[index++] = 0xF0;
+                _buffer()[index++] = 0xF0;
             }
 
 
             // **Copy SysEx Data (Avoid Duplicating Start/End Bytes)**
-            for (size_t i = 0; i < Length; i++) {
-                _Data[index++] = Data[i];
-            }
+            memcpy(_buffer() + index, Data, Length);
+            index += Length;
             
             // **Add SysEx End (0xF7) if missing**
             if (Data[Length - 1] != 0xF7) {
-                _Data[index++] = 0xF7;
+                _buffer()[index++] = 0xF7;
             }
 
             return *this;
@@ -845,10 +922,58 @@ namespace MIDILAR::MidiCore{
                     _resize(0); // Clear the message if the input vector is empty
                     return *this;  // No data to process
                 }
-                return SystemExclusive(Data.data(), static_cast<uint8_t>(Data.size()));
+                return SystemExclusive(Data.data(), Data.size());
             }
             
         #endif
+
+        Message& Message::BeginSysEx(size_t ExpectedSize) {
+            if (ExpectedSize > 0) {
+                Reserve(ExpectedSize);
+            }
+
+            if (_resize(1)) {
+                _buffer()[0] = MIDI_SYSEX_START;
+            }
+            return *this;
+        }
+
+        Message& Message::EndSysEx() {
+            size_t length = size();
+            if (length == 0 || _buffer()[0] != MIDI_SYSEX_START) {
+                return *this; // Not a SysEx message
+            }
+
+            if (_buffer()[length - 1] != MIDI_SYSEX_END) {
+                uint8_t end = MIDI_SYSEX_END;
+                Append(&end, 1);
+            }
+            return *this;
+        }
+
+        Message& Message::AppendPacked7Bit(const uint8_t* Data, size_t Size) {
+            if (!Data || Size == 0) {
+                return *this; // No data to append
+            }
+
+            size_t offset = size();
+            if (_resize(offset + MidiProtocol::SysExCodec::Pack7BitSize(Size))) {
+                MidiProtocol::SysExCodec::Pack7Bit(Data, Size, _buffer() + offset);
+            }
+            return *this;
+        }
+
+        Message& Message::AppendNibblized(const uint8_t* Data, size_t Size, bool LowNibbleFirst) {
+            if (!Data || Size == 0) {
+                return *this; // No data to append
+            }
+
+            size_t offset = size();
+            if (_resize(offset + MidiProtocol::SysExCodec::NibblizeSize(Size))) {
+                MidiProtocol::SysExCodec::Nibblize(Data, Size, _buffer() + offset, LowNibbleFirst);
+            }
+            return *this;
+        }
     //
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
\ No newline at end of file
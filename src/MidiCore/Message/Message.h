@@ -18,6 +18,22 @@
     #include <MidiCore/Protocol/Defines.h>
     #include <MidiCore/Protocol/Enums.h>
 
+    #if defined(MIDILAR_MESSAGE_POOL)
+        #include <MidiCore/Message/MessagePool.h>
+    #endif
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief Number of bytes a `Message` can hold without allocating heap memory.
+     *
+     * Messages whose size fits in this capacity (every Channel Voice, System Common and Real-Time
+     * message, and short SysEx such as MTC Full Frame) are stored inline inside the object.
+     * Larger messages spill to heap storage. Can be overridden at build time.
+     */
+    #ifndef MIDILAR_MESSAGE_INLINE_CAPACITY
+        #define MIDILAR_MESSAGE_INLINE_CAPACITY 8
+    #endif
+
     namespace MIDILAR::MidiCore{
         
         //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,14 +70,20 @@
          */
             class Message {
 
+            public:
+                static constexpr size_t InlineCapacity = MIDILAR_MESSAGE_INLINE_CAPACITY; ///< Bytes stored without heap allocation.
+
+                static_assert(InlineCapacity >= 3, "MIDILAR_MESSAGE_INLINE_CAPACITY must hold at least a 3 byte message");
+
             protected:
             #if __has_include(<vector>)
-                std::vector<uint8_t> _Data;
+                mutable std::vector<uint8_t> _Data; ///< Heap storage, in use once its capacity is non-zero.
             #else
-                uint8_t* _Data;
-                size_t _BufferSize;
-                size_t _MessageSize;
+                uint8_t* _Data;                     ///< Heap storage, in use when not null.
+                size_t _BufferSize;                 ///< Capacity of the heap storage.
             #endif
+                size_t _MessageSize;                ///< Message size while the inline storage is in use.
+                uint8_t _Inline[InlineCapacity];    ///< Inline storage for short messages.
 
             public:
 
@@ -75,6 +97,8 @@
                     Message(Message&& MessageBuffer) noexcept;  ///< Move constructor.
                     Message(uint8_t* Buffer, uint8_t size);        ///< Constructor from a raw character buffer.
                     
+                    ~Message();                                 ///< Destructor.
+
                     Message& operator=(const Message& Source);
                     Message& operator=(Message&& Source) noexcept;
 
@@ -93,8 +117,11 @@
                     const uint8_t* Buffer() const; ///< Returns a pointer to the first data element stored in the message
                     uint8_t Data(size_t index) const; ///< Returns the data stored at the specified index
                     size_t size() const;  ///< Returns the size of the message stored in the object.  
+                    bool IsInline() const; ///< Returns true while the message is held in the inline storage.
 
                     Message& SetRawData(const uint8_t* Data, size_t Size);
+                    Message& Append(const uint8_t* Data, size_t Size); ///< Appends raw bytes to the end of the message.
+                    bool Reserve(size_t Capacity); ///< Preallocates storage for at least `Capacity` bytes. Returns false if allocation failed.
                
                     #if __has_include(<vector>)
                      Message& SetRawData(const std::vector<uint8_t>& Data);
@@ -106,6 +133,8 @@
                 * @name Vector API
                 * @brief Set of functions to access the data when std::vector is available.
                 * This set of functions does not replace the Data Access group of functions but adds on to enhance the member data accessibility.
+                * Calling any of them moves an inline message to heap storage so the returned vector and iterators
+                * stay valid for subsequent modifications.
                 * @{
                 */
                     #if __has_include(<vector>)
@@ -707,12 +736,14 @@
                           * @brief Sends a Non-Registered Parameter Number (NRPN) message with an 8-bit data value.
                           *
                           * NRPNs allow for manufacturer-specific or extended MIDI control beyond standard CC messages.
+                          * The message holds CC 99, 98 and 6 using running status (7 bytes).
                           *
                           * @param ParameterID The 14-bit NRPN parameter identifier (0-16383).
                           * @param Data The 8-bit data value (0-127) to send for the specified NRPN parameter.
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
                           * @return A reference to the updated `Message` object.
                           */
-                             Message& CC_NRPN(uint16_t ParameterID, uint8_t Data);
+                             Message& CC_NRPN(uint16_t ParameterID, uint8_t Data, uint8_t Channel = 0);
                          //
                          ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                          // CC_NRPN(uint16_t ParameterID, uint16_t Data);
@@ -720,12 +751,42 @@
                           * @brief Sends a Non-Registered Parameter Number (NRPN) message with a 16-bit data value.
                           *
                           * This overload allows sending NRPN messages that require a full 14-bit data value.
+                          * The message holds CC 99, 98, 6 and 38 using running status (9 bytes instead of 12).
                           *
                           * @param ParameterID The 14-bit NRPN parameter identifier (0-16383).
                           * @param Data The 14-bit data value (0-16383) to send for the specified NRPN parameter.
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
                           * @return A reference to the updated `Message` object.
                           */
-                             Message& CC_NRPN(uint16_t ParameterID, uint16_t Data);
+                             Message& CC_NRPN(uint16_t ParameterID, uint16_t Data, uint8_t Channel = 0);
+                         //
+                         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                         // CC_RPN(uint16_t ParameterID, uint8_t Data);
+                         /**
+                          * @brief Sends a Registered Parameter Number (RPN) message with an 8-bit data value.
+                          *
+                          * The message holds CC 101, 100 and 6 using running status (7 bytes).
+                          *
+                          * @param ParameterID The 14-bit RPN parameter identifier (0-16383).
+                          * @param Data The data value (0-127) to send for the specified RPN parameter.
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
+                          * @return A reference to the updated `Message` object.
+                          */
+                             Message& CC_RPN(uint16_t ParameterID, uint8_t Data, uint8_t Channel = 0);
+                         //
+                         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                         // CC_RPN(uint16_t ParameterID, uint16_t Data);
+                         /**
+                          * @brief Sends a Registered Parameter Number (RPN) message with a 14-bit data value.
+                          *
+                          * The message holds CC 101, 100, 6 and 38 using running status (9 bytes instead of 12).
+                          *
+                          * @param ParameterID The 14-bit RPN parameter identifier (0-16383).
+                          * @param Data The 14-bit data value (0-16383) to send for the specified RPN parameter.
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
+                          * @return A reference to the updated `Message` object.
+                          */
+                             Message& CC_RPN(uint16_t ParameterID, uint16_t Data, uint8_t Channel = 0);
                          //
                          ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                          // CC_NRPN_DataIncrement();
@@ -735,9 +796,10 @@
                           * This message increases the value of the currently selected NRPN parameter by 1.
                           * It is typically used for relative control of parameters.
                           *
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
                           * @return A reference to the updated `Message` object.
                           */
-                             Message& CC_NRPN_DataIncrement();
+                             Message& CC_NRPN_DataIncrement(uint8_t Channel = 0);
                          //
                          ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                          // CC_NRPN_DataDecrement();
@@ -747,9 +809,10 @@
                           * This message decreases the value of the currently selected NRPN parameter by 1.
                           * It is typically used for relative control of parameters.
                           *
+                          * @param Channel The MIDI channel (0-15). Defaults to 0. Values outside this range will be clamped.
                           * @return A reference to the updated `Message` object.
                           */
-                             Message& CC_NRPN_DataDecrement();
+                             Message& CC_NRPN_DataDecrement(uint8_t Channel = 0);
                          //
                          ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                      //
@@ -975,7 +1038,7 @@
                 * @{
                 */
                   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-                  // Message& SystemExclusive(uint8_t* Data, uint8_t Length);
+                  // Message& SystemExclusive(const uint8_t* Data, size_t Length);
                   /**
                    * @brief Constructs a System Exclusive (SysEx) message.
                    * 
@@ -983,11 +1046,14 @@
                    * raw byte data. SysEx messages allow for manufacturer-specific or extended 
                    * MIDI functionality beyond the standard protocol.
                    * 
+                   * The start (0xF0) and end (0xF7) bytes are added when missing. The storage is
+                   * allocated once for the final size.
+                   * 
                    * @param Data Pointer to the raw SysEx message data.
                    * @param Length The number of bytes in the SysEx message.
                    * @return Reference to the modified Message object.
                    */
-                     Message& SystemExclusive(const uint8_t* Data, uint8_t Length); ///< Constructs a System Exclusive message.
+                     Message& SystemExclusive(const uint8_t* Data, size_t Length); ///< Constructs a System Exclusive message.
                   //
                   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                   // SystemExclusive(const std::vector<uint8_t>& Data);
@@ -1009,6 +1075,57 @@
                      #endif
                   //
                   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                  // Chunked SysEx construction
+                  /**
+                   * @brief Starts a System Exclusive message built in chunks.
+                   *
+                   * Replaces the message with a single SysEx start byte (0xF0). Payload chunks are then added
+                   * with `Append()` and the message is closed with `EndSysEx()`.
+                   *
+                   * ```cpp
+                   * msg.BeginSysEx(header_size + dump_size + 1);
+                   * msg.Append(header, header_size);
+                   * msg.Append(dump, dump_size);
+                   * msg.EndSysEx();
+                   * ```
+                   *
+                   * @param ExpectedSize Total size of the finished message, used to reserve storage once. 0 skips the reservation.
+                   * @return Reference to the modified Message object.
+                   */
+                     Message& BeginSysEx(size_t ExpectedSize = 0);
+
+                  /**
+                   * @brief Closes a System Exclusive message started with `BeginSysEx()`.
+                   *
+                   * Appends the SysEx end byte (0xF7) unless the message already ends with it.
+                   * Has no effect if the message is not a SysEx message.
+                   *
+                   * @return Reference to the modified Message object.
+                   */
+                     Message& EndSysEx();
+
+                  /**
+                   * @brief Appends 8-bit data using 7-in-8 packing ("MSB byte first").
+                   *
+                   * Intended for payloads between `BeginSysEx()` and `EndSysEx()`. Each call packs its data as
+                   * independent groups, so splitting a payload across calls gives the same result only when every
+                   * call but the last carries a multiple of 7 bytes.
+                   *
+                   * @see MIDILAR::MidiCore::Protocol::SysExCodec::Pack7Bit
+                   * @return Reference to the modified Message object.
+                   */
+                     Message& AppendPacked7Bit(const uint8_t* Data, size_t Size);
+
+                  /**
+                   * @brief Appends 8-bit data as pairs of 4-bit data bytes.
+                   *
+                   * @see MIDILAR::MidiCore::Protocol::SysExCodec::Nibblize
+                   * @param LowNibbleFirst When true, the low nibble of each byte is written first.
+                   * @return Reference to the modified Message object.
+                   */
+                     Message& AppendNibblized(const uint8_t* Data, size_t Size, bool LowNibbleFirst = false);
+                  //
+                  ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
                   // MTC Full frame
                            
                      /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1061,6 +1178,15 @@
                 private:
 
                     bool _resize(size_t new_size); ///< Resizes the internal buffer for MIDI data.
+                    uint8_t* _buffer();            ///< Returns the storage currently holding the message bytes.
+                    const uint8_t* _buffer() const;
+
+                    #if __has_include(<vector>)
+                        void _promote() const;     ///< Moves an inline message into the heap vector.
+                    #else
+                        uint8_t* _allocate(size_t Size, size_t& Capacity); ///< Allocates heap storage of at least `Size` bytes, from the `MessagePool` when enabled.
+                        void _release();           ///< Releases the heap storage, if any.
+                    #endif
                 
             };
         //
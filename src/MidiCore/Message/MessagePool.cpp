@@ -0,0 +1,83 @@
+#include "MessagePool.h"
+
+namespace MIDILAR::MidiCore{
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Pool storage
+
+        struct PoolStorage {
+            SystemCore::BlockPool<16, MIDILAR_MESSAGE_POOL_BLOCKS_16> Pool16;
+            SystemCore::BlockPool<64, MIDILAR_MESSAGE_POOL_BLOCKS_64> Pool64;
+            SystemCore::BlockPool<256, MIDILAR_MESSAGE_POOL_BLOCKS_256> Pool256;
+            SystemCore::BlockPoolAtomic<uint32_t> HeapAllocations{0};
+        };
+
+        // Constructed on first use, so messages in other static objects can allocate during static initialization
+        PoolStorage& _pools() {
+            static PoolStorage pools;
+            return pools;
+        }
+
+        template <typename Pool>
+        MessagePool::Statistics _statistics(const Pool& Source) {
+            return {Pool::BlockSize, Pool::BlockCount, Source.InUse(), Source.HighWaterMark(), Source.FailedAllocations()};
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Allocation
+
+        uint8_t* MessagePool::Allocate(size_t Size, size_t& Capacity) {
+            PoolStorage& pools = _pools();
+            void* block = nullptr;
+
+            // Try the smallest class that fits, then the larger ones
+            if (Size <= 16 && (block = pools.Pool16.Allocate()) != nullptr) {
+                Capacity = 16;
+            } else if (Size <= 64 && (block = pools.Pool64.Allocate()) != nullptr) {
+                Capacity = 64;
+            } else if (Size <= 256 && (block = pools.Pool256.Allocate()) != nullptr) {
+                Capacity = 256;
+            }
+            return static_cast<uint8_t*>(block);
+        }
+
+        bool MessagePool::Deallocate(uint8_t* Block) {
+            PoolStorage& pools = _pools();
+            return pools.Pool16.Deallocate(Block) || pools.Pool64.Deallocate(Block) || pools.Pool256.Deallocate(Block);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Statistics
+
+        MessagePool::Statistics MessagePool::GetStatistics(size_t ClassIndex) {
+            PoolStorage& pools = _pools();
+            switch (ClassIndex) {
+                case 0:  return _statistics(pools.Pool16);
+                case 1:  return _statistics(pools.Pool64);
+                case 2:  return _statistics(pools.Pool256);
+                default: return {0, 0, 0, 0, 0};
+            }
+        }
+
+        size_t MessagePool::HeapAllocations() {
+            return _pools().HeapAllocations.load();
+        }
+
+        void MessagePool::CountHeapAllocation() {
+            _pools().HeapAllocations.fetch_add(1);
+        }
+
+        void MessagePool::ResetStatistics() {
+            PoolStorage& pools = _pools();
+            pools.Pool16.ResetStatistics();
+            pools.Pool64.ResetStatistics();
+            pools.Pool256.ResetStatistics();
+            pools.HeapAllocations.store(0);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
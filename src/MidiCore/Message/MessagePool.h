@@ -0,0 +1,102 @@
+#ifndef MIDILAR_MIDI_MESSAGE_POOL_H
+#define MIDILAR_MIDI_MESSAGE_POOL_H
+
+/**
+ * @file MessagePool.h
+ * @brief Provides the `MessagePool` block allocator used by `Message` heap storage in builds without `<vector>`.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <SystemCore/BlockPool/BlockPool.h>
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @name Message Pool Sizes
+     * @brief Number of blocks in each size class of the `MessagePool`. Can be overridden at build time.
+     * @{
+     */
+    #ifndef MIDILAR_MESSAGE_POOL_BLOCKS_16
+        #define MIDILAR_MESSAGE_POOL_BLOCKS_16 32
+    #endif
+    #ifndef MIDILAR_MESSAGE_POOL_BLOCKS_64
+        #define MIDILAR_MESSAGE_POOL_BLOCKS_64 16
+    #endif
+    #ifndef MIDILAR_MESSAGE_POOL_BLOCKS_256
+        #define MIDILAR_MESSAGE_POOL_BLOCKS_256 8
+    #endif
+    /**@}*/
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class MessagePool
+         * @brief Process-wide fixed-block allocator for `Message` heap storage.
+         *
+         * Without `<vector>`, every `Message` that outgrows its inline storage would otherwise go
+         * through `calloc` and `free`. On long-running embedded targets this fragments the heap. When
+         * `MIDILAR_MESSAGE_POOL` is defined, `Message` takes its storage from three statically
+         * allocated `SystemCore::BlockPool` size classes of 16, 64 and 256 bytes instead. `Message`
+         * never requests less than twice its inline capacity, so there is no smaller class.
+         *
+         * A request is served by the smallest class that fits; when that class is empty the next
+         * larger one is tried. Requests larger than 256 bytes, or that no class can serve, fall back
+         * to the heap and are counted in `HeapAllocations()`. Together with the per-class high-water
+         * marks and failure counts this tells how to size the pools of a deployment.
+         *
+         * Allocation and release are lock-free.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * for (size_t i = 0; i < MessagePool::ClassCount; i++) {
+         *     MessagePool::Statistics stats = MessagePool::GetStatistics(i);
+         *     printf("%zu bytes: %zu/%zu peak, %zu failed\n", stats.BlockSize, stats.HighWaterMark, stats.BlockCount, stats.FailedAllocations);
+         * }
+         * ```
+         */
+            class MessagePool {
+
+            public:
+                static constexpr size_t ClassCount = 3;                         ///< Number of block size classes.
+                static constexpr size_t MaxBlockSize = 256;                     ///< Largest block served by the pool.
+
+                /**
+                 * @brief Usage statistics of one size class.
+                 */
+                struct Statistics {
+                    size_t BlockSize;           ///< Size of one block in bytes.
+                    size_t BlockCount;          ///< Number of blocks in the class.
+                    size_t InUse;               ///< Blocks currently allocated.
+                    size_t HighWaterMark;       ///< Largest number of blocks allocated at once.
+                    size_t FailedAllocations;   ///< Allocations that found the class empty.
+                };
+
+                /**
+                 * @brief Allocates a block holding at least `Size` bytes.
+                 * @param Size Requested size in bytes.
+                 * @param Capacity Receives the size of the returned block.
+                 * @return The block, or nullptr if no class can serve the request.
+                 */
+                static uint8_t* Allocate(size_t Size, size_t& Capacity);
+
+                /**
+                 * @brief Returns a block to its pool.
+                 * @return False if the pointer was not allocated by the pool.
+                 */
+                static bool Deallocate(uint8_t* Block);
+
+                static Statistics GetStatistics(size_t ClassIndex);    ///< Returns the statistics of a size class, all zero for an invalid index.
+                static size_t HeapAllocations();                       ///< Number of `Message` allocations that fell back to the heap.
+                static void CountHeapAllocation();                     ///< Records an allocation served by the heap.
+                static void ResetStatistics();                         ///< Restarts every high-water mark and clears the failure counters.
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_MESSAGE_POOL_H
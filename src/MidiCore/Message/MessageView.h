@@ -0,0 +1,175 @@
+#ifndef MIDILAR_MIDI_MESSAGE_VIEW_H
+#define MIDILAR_MIDI_MESSAGE_VIEW_H
+
+/**
+ * @file MessageView.h
+ * @brief Provides the `MessageView` class, a non-owning typed view over MIDI message bytes.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Protocol/StatusTable.h>
+    #include <MidiCore/Protocol/SysExCodec.h>
+    #include <MidiCore/Message/Message.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class MessageView
+         * @brief Non-owning view of a complete MIDI message with typed accessors.
+         *
+         * `MessageView` wraps a pointer and a size (for example the buffer handed out by `MessageParser`)
+         * and decodes the message on demand. The status byte is classified through
+         * `Protocol::StatusTable`, so `Kind()` and `Category()` cost a single table lookup.
+         *
+         * Typed accessors read the bytes at the position defined by the MIDI protocol for that message.
+         * They do not check the kind; accessing a field that does not exist in the message returns 0.
+         *
+         * The view does not copy the data. It stays valid only as long as the underlying buffer.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * void OnChannelVoice(const MessageView& msg) {
+         *     if (msg.Kind() == MidiProtocol::MessageKind::NoteOn) {
+         *         Play(msg.Channel(), msg.Note(), msg.Velocity());
+         *     }
+         * }
+         * ```
+         *
+         * @see MIDILAR::MidiCore::Message
+         * @see MIDILAR::MidiCore::Protocol::StatusTable
+         */
+            class MessageView {
+
+            private:
+                const uint8_t* _Data;   ///< First byte of the viewed message.
+                size_t _Size;           ///< Size of the viewed message in bytes.
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Constructors
+                * @{
+                */
+                    constexpr MessageView() noexcept : _Data(nullptr), _Size(0) {}                                        ///< Constructs an empty view.
+                    constexpr MessageView(const uint8_t* Data, size_t Size) noexcept : _Data(Data), _Size(Data ? Size : 0) {} ///< Constructs a view over a raw buffer.
+                    MessageView(const Message& Source) noexcept : MessageView(Source.Buffer(), Source.size()) {}          ///< Constructs a view over a `Message`.
+
+                    operator Message() const { Message msg; msg.SetRawData(_Data, _Size); return msg; } ///< Copies the viewed bytes into a `Message`.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Data Access
+                * @{
+                */
+                    constexpr const uint8_t* Buffer() const noexcept { return _Data; }                               ///< Returns a pointer to the first byte.
+                    constexpr size_t size() const noexcept { return _Size; }                                         ///< Returns the size of the message in bytes.
+                    constexpr bool empty() const noexcept { return _Size == 0; }                                     ///< Returns true if the view holds no bytes.
+                    constexpr uint8_t Data(size_t index) const noexcept { return (index < _Size) ? _Data[index] : 0; } ///< Returns the byte at the specified index, or 0 when out of bounds.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Classification
+                * @{
+                */
+                    constexpr uint8_t Status() const noexcept { return Data(0); } ///< Returns the status byte, or 0 when empty.
+
+                    constexpr MidiProtocol::MessageKind Kind() const noexcept {
+                        return (_Size > 0) ? MidiProtocol::StatusTable[_Data[0]].Kind : MidiProtocol::MessageKind::Data;
+                    } ///< Returns the kind of message.
+
+                    constexpr MidiProtocol::MessageCategory Category() const noexcept {
+                        return (_Size > 0) ? MidiProtocol::StatusTable[_Data[0]].Category : MidiProtocol::MessageCategory::None;
+                    } ///< Returns the category of message.
+
+                    constexpr bool IsChannelVoice() const noexcept { return Category() == MidiProtocol::MessageCategory::ChannelVoice; }
+                    constexpr bool IsSystemCommon() const noexcept { return Category() == MidiProtocol::MessageCategory::SystemCommon; }
+                    constexpr bool IsRealTime() const noexcept { return Category() == MidiProtocol::MessageCategory::RealTime; }
+                    constexpr bool IsSysEx() const noexcept { return Kind() == MidiProtocol::MessageKind::SysExStart; }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Channel Voice Accessors
+                * @{
+                */
+                    constexpr uint8_t Channel() const noexcept { return IsChannelVoice() ? (_Data[0] & 0x0F) : 0; } ///< Returns the channel (0-15).
+                    constexpr uint8_t Note() const noexcept { return Data(1); }             ///< Returns the note of a Note On, Note Off or AfterTouch message.
+                    constexpr uint8_t Velocity() const noexcept { return Data(2); }         ///< Returns the velocity of a Note On or Note Off message.
+                    constexpr uint8_t Pressure() const noexcept {
+                        return (Kind() == MidiProtocol::MessageKind::ChannelPressure) ? Data(1) : Data(2);
+                    } ///< Returns the pressure of an AfterTouch or Channel Pressure message.
+                    constexpr uint8_t Controller() const noexcept { return Data(1); }       ///< Returns the controller number of a Control Change message.
+                    constexpr uint8_t ControllerValue() const noexcept { return Data(2); }  ///< Returns the value of a Control Change message.
+                    constexpr uint8_t Program() const noexcept { return Data(1); }          ///< Returns the program of a Program Change message.
+
+                    /**
+                     * @brief Returns the unsigned 14-bit value (0-16383, center 8192) of a Pitch Bend message.
+                     */
+                    constexpr uint16_t PitchBend14() const noexcept {
+                        return static_cast<uint16_t>((Data(1) & 0x7F) | ((Data(2) & 0x7F) << 7));
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name System Accessors
+                * @{
+                */
+                    /**
+                     * @brief Returns the 14-bit position of a Song Position Pointer message.
+                     */
+                    constexpr uint16_t SongPosition() const noexcept {
+                        return static_cast<uint16_t>((Data(1) & 0x7F) | ((Data(2) & 0x7F) << 7));
+                    }
+
+                    /**
+                     * @brief Returns a pointer to the SysEx payload, excluding the 0xF0 and 0xF7 framing bytes.
+                     * @return nullptr if the view is not a SysEx message or has no payload.
+                     */
+                    constexpr const uint8_t* SysExPayload() const noexcept {
+                        return (SysExPayloadSize() > 0) ? (_Data + 1) : nullptr;
+                    }
+
+                    /**
+                     * @brief Returns the size of the SysEx payload, excluding the 0xF0 and 0xF7 framing bytes.
+                     */
+                    constexpr size_t SysExPayloadSize() const noexcept {
+                        return !IsSysEx() ? 0 : (_Data[_Size - 1] == MIDI_SYSEX_END) ? (_Size - 2) : (_Size - 1);
+                    }
+
+                    /**
+                     * @brief Unpacks 7-in-8 packed SysEx data into `Out`.
+                     *
+                     * `Offset` skips payload bytes that are not packed, such as the manufacturer ID and
+                     * command bytes. `Out` must hold `Protocol::SysExCodec::Unpack7BitSize(SysExPayloadSize() - Offset)` bytes.
+                     * @return Number of bytes written, 0 if the view is not a SysEx message.
+                     */
+                    inline size_t SysExUnpack7Bit(size_t Offset, uint8_t* Out) const {
+                        size_t size = SysExPayloadSize();
+                        return (size > Offset) ? MidiProtocol::SysExCodec::Unpack7Bit(_Data + 1 + Offset, size - Offset, Out) : 0;
+                    }
+
+                    /**
+                     * @brief Joins nibblized SysEx data into `Out`.
+                     *
+                     * `Offset` skips payload bytes that are not nibblized. `Out` must hold
+                     * `(SysExPayloadSize() - Offset) / 2` bytes.
+                     * @return Number of bytes written, 0 if the view is not a SysEx message.
+                     */
+                    inline size_t SysExDenibblize(size_t Offset, uint8_t* Out, bool LowNibbleFirst = false) const {
+                        size_t size = SysExPayloadSize();
+                        return (size > Offset) ? MidiProtocol::SysExCodec::Denibblize(_Data + 1 + Offset, size - Offset, Out, LowNibbleFirst) : 0;
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_MESSAGE_VIEW_H
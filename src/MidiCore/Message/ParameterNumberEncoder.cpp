@@ -0,0 +1,111 @@
+#include "ParameterNumberEncoder.h"
+
+namespace MIDILAR::MidiCore{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stateless Encoding
+
+        size_t ParameterNumberEncoder::Write(uint8_t* Out, Type ParameterType, uint16_t ParameterID, uint16_t Value, bool Fine, uint8_t Channel,
+                                             bool SelectParameter, bool WriteStatus) {
+            size_t index = 0;
+
+            if (WriteStatus) {
+                Out[index++] = MIDI_CONTROL_CHANGE + ((Channel < 15) ? Channel : 15);
+            }
+
+            if (SelectParameter) {
+                ParameterID &= 0x3FFF;
+                Out[index++] = (ParameterType == Type::RPN) ? MIDI_RPN_MSB : MIDI_NRPN_MSB;
+                Out[index++] = static_cast<uint8_t>(ParameterID >> 7);
+                Out[index++] = (ParameterType == Type::RPN) ? MIDI_RPN_LSB : MIDI_NRPN_LSB;
+                Out[index++] = static_cast<uint8_t>(ParameterID & 0x7F);
+            }
+
+            if (Fine) {
+                Value = (Value < 0x3FFF) ? Value : 0x3FFF;
+                Out[index++] = MIDI_DATA_ENTRY_MSB;
+                Out[index++] = static_cast<uint8_t>(Value >> 7);
+                Out[index++] = MIDI_DATA_ENTRY_LSB;
+                Out[index++] = static_cast<uint8_t>(Value & 0x7F);
+            } else {
+                Out[index++] = MIDI_DATA_ENTRY_MSB;
+                Out[index++] = static_cast<uint8_t>((Value < 127) ? Value : 127);
+            }
+
+            return index;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stateful Encoding
+
+        ParameterNumberEncoder::ParameterNumberEncoder() {
+            Reset();
+        }
+
+        size_t ParameterNumberEncoder::_write(uint8_t* Out, Type ParameterType, uint16_t ParameterID, uint16_t Value, bool Fine, uint8_t Channel) {
+            Channel = (Channel < 15) ? Channel : 15;
+
+            uint8_t status = MIDI_CONTROL_CHANGE + Channel;
+            uint16_t selected = 0x8000 | ((ParameterType == Type::RPN) ? 0x4000 : 0) | (ParameterID & 0x3FFF);
+
+            size_t size = Write(Out, ParameterType, ParameterID, Value, Fine, Channel,
+                                _Selected[Channel] != selected, _RunningStatus != status);
+
+            _Selected[Channel] = selected;
+            _RunningStatus = status;
+            return size;
+        }
+
+        size_t ParameterNumberEncoder::_dataStep(uint8_t* Out, uint8_t Controller, uint8_t Channel) {
+            Channel = (Channel < 15) ? Channel : 15;
+
+            uint8_t status = MIDI_CONTROL_CHANGE + Channel;
+            size_t index = 0;
+
+            if (_RunningStatus != status) {
+                Out[index++] = status;
+            }
+            Out[index++] = Controller;
+            Out[index++] = 0x00; // Data byte is ignored by the receiver
+
+            _RunningStatus = status;
+            return index;
+        }
+
+        size_t ParameterNumberEncoder::NRPN(uint8_t* Out, uint16_t ParameterID, uint16_t Value, uint8_t Channel) {
+            return _write(Out, Type::NRPN, ParameterID, Value, true, Channel);
+        }
+
+        size_t ParameterNumberEncoder::NRPNCoarse(uint8_t* Out, uint16_t ParameterID, uint8_t Value, uint8_t Channel) {
+            return _write(Out, Type::NRPN, ParameterID, Value, false, Channel);
+        }
+
+        size_t ParameterNumberEncoder::RPN(uint8_t* Out, uint16_t ParameterID, uint16_t Value, uint8_t Channel) {
+            return _write(Out, Type::RPN, ParameterID, Value, true, Channel);
+        }
+
+        size_t ParameterNumberEncoder::RPNCoarse(uint8_t* Out, uint16_t ParameterID, uint8_t Value, uint8_t Channel) {
+            return _write(Out, Type::RPN, ParameterID, Value, false, Channel);
+        }
+
+        size_t ParameterNumberEncoder::DataIncrement(uint8_t* Out, uint8_t Channel) {
+            return _dataStep(Out, MIDI_NRPN_DATA_INCREMENT, Channel);
+        }
+
+        size_t ParameterNumberEncoder::DataDecrement(uint8_t* Out, uint8_t Channel) {
+            return _dataStep(Out, MIDI_NRPN_DATA_DECREMENT, Channel);
+        }
+
+        void ParameterNumberEncoder::InvalidateRunningStatus() {
+            _RunningStatus = 0;
+        }
+
+        void ParameterNumberEncoder::Reset() {
+            for (size_t i = 0; i < 16; i++) {
+                _Selected[i] = 0;
+            }
+            _RunningStatus = 0;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,115 @@
+#ifndef MIDILAR_MIDI_PARAMETER_NUMBER_ENCODER_H
+#define MIDILAR_MIDI_PARAMETER_NUMBER_ENCODER_H
+
+/**
+ * @file ParameterNumberEncoder.h
+ * @brief Provides the `ParameterNumberEncoder` class for writing compact RPN and NRPN sequences.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <MidiCore/Protocol/Defines.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class ParameterNumberEncoder
+         * @brief Writes RPN and NRPN Control Change sequences using running status.
+         *
+         * A parameter write is a sequence of Control Change messages: the parameter number
+         * (CC 99/98 for NRPN, CC 101/100 for RPN) followed by the data entry (CC 6/38). Because all
+         * of them share the same status byte, the status is written once and the remaining CCs
+         * use running status. A full 14-bit write therefore takes 9 bytes instead of 12.
+         *
+         * The encoder also remembers the parameter selected on each channel and the last status
+         * byte written. Consecutive writes to the same parameter skip the parameter number CCs and
+         * the status byte, down to 4 bytes for a 14-bit value. This is the common case for dense
+         * automation of a single parameter.
+         *
+         * The remembered state is only valid while every byte sent on the link comes from this
+         * encoder. Call `InvalidateRunningStatus()` after sending any other message, and `Reset()`
+         * if the receiver may have lost its parameter selection.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * ParameterNumberEncoder encoder;
+         * uint8_t buffer[ParameterNumberEncoder::MaxSize];
+         *
+         * size_t size = encoder.NRPN(buffer, 0x0123, 8192, 0);  // 9 bytes
+         * size = encoder.NRPN(buffer, 0x0123, 8200, 0);         // 4 bytes
+         * ```
+         */
+            class ParameterNumberEncoder {
+
+            public:
+
+                /**
+                 * @brief Parameter number space.
+                 */
+                enum class Type : uint8_t {
+                    NRPN = 0,   ///< Non-Registered Parameter Number (CC 99/98).
+                    RPN = 1     ///< Registered Parameter Number (CC 101/100).
+                };
+
+                static constexpr size_t MaxSize = 9; ///< Largest sequence written by a single call.
+
+            private:
+                uint16_t _Selected[16];     ///< Selected parameter per channel: bit 15 valid, bit 14 RPN, bits 0-13 parameter number.
+                uint8_t _RunningStatus;     ///< Last status byte written, 0 when unknown.
+
+                size_t _write(uint8_t* Out, Type ParameterType, uint16_t ParameterID, uint16_t Value, bool Fine, uint8_t Channel);
+                size_t _dataStep(uint8_t* Out, uint8_t Controller, uint8_t Channel);
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Stateless Encoding
+                * @{
+                */
+                    /**
+                     * @brief Writes a complete parameter sequence with running status.
+                     *
+                     * @param Out Destination buffer, at least `MaxSize` bytes.
+                     * @param ParameterType RPN or NRPN.
+                     * @param ParameterID 14-bit parameter number (0-16383).
+                     * @param Value Data value: 14-bit when `Fine` is true, 7-bit otherwise.
+                     * @param Fine When true, writes both Data Entry MSB and LSB; otherwise only the MSB.
+                     * @param Channel The MIDI channel (0-15). Values outside this range will be clamped.
+                     * @param SelectParameter When false, the parameter number CCs are omitted.
+                     * @param WriteStatus When false, the leading status byte is omitted.
+                     * @return Number of bytes written.
+                     */
+                    static size_t Write(uint8_t* Out, Type ParameterType, uint16_t ParameterID, uint16_t Value, bool Fine, uint8_t Channel,
+                                        bool SelectParameter = true, bool WriteStatus = true);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Stateful Encoding
+                * @brief Each function writes at most `MaxSize` bytes into `Out` and returns the number of bytes written.
+                * @{
+                */
+                    ParameterNumberEncoder(); ///< Constructs an encoder with no parameter selected.
+
+                    size_t NRPN(uint8_t* Out, uint16_t ParameterID, uint16_t Value, uint8_t Channel = 0);      ///< Writes a 14-bit NRPN value.
+                    size_t NRPNCoarse(uint8_t* Out, uint16_t ParameterID, uint8_t Value, uint8_t Channel = 0); ///< Writes a 7-bit NRPN value (Data Entry MSB only).
+                    size_t RPN(uint8_t* Out, uint16_t ParameterID, uint16_t Value, uint8_t Channel = 0);       ///< Writes a 14-bit RPN value.
+                    size_t RPNCoarse(uint8_t* Out, uint16_t ParameterID, uint8_t Value, uint8_t Channel = 0);  ///< Writes a 7-bit RPN value (Data Entry MSB only).
+
+                    size_t DataIncrement(uint8_t* Out, uint8_t Channel = 0); ///< Writes a Data Increment for the selected parameter.
+                    size_t DataDecrement(uint8_t* Out, uint8_t Channel = 0); ///< Writes a Data Decrement for the selected parameter.
+
+                    void InvalidateRunningStatus(); ///< Forces the next write to include the status byte.
+                    void Reset();                   ///< Forgets the running status and every selected parameter.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_PARAMETER_NUMBER_ENCODER_H
@@ -0,0 +1,301 @@
+#ifndef MIDILAR_MIDI_SHORT_MESSAGE_H
+#define MIDILAR_MIDI_SHORT_MESSAGE_H
+
+/**
+ * @file ShortMessage.h
+ * @brief Provides the `ShortMessage` value type for MIDI messages of up to three bytes.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Protocol/Enums.h>
+    #include <MidiCore/Protocol/StatusTable.h>
+    #include <MidiCore/Message/Message.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class ShortMessage
+         * @brief Trivially copyable MIDI message of up to three bytes packed into a `uint32_t`.
+         *
+         * `ShortMessage` covers every Channel Voice, System Common and Real-Time message. It is meant
+         * to be passed by value through queues (e.g. `SystemCore::RingBuffer<ShortMessage>`) and arrays
+         * without any heap storage. All builders are `constexpr` and mirror the `Message` builders,
+         * including their clamping rules.
+         *
+         * The packed layout is `status | data1 << 8 | data2 << 16 | size << 24`.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * constexpr ShortMessage note = ShortMessage::NoteOn(60, 127, 0);
+         * Message msg = note;           // Converts to a Message
+         * ShortMessage back = msg;      // And back
+         * ```
+         *
+         * @see MIDILAR::MidiCore::Message
+         */
+            class ShortMessage {
+
+            private:
+                uint32_t _Packed; ///< Packed status, data bytes and size.
+
+                static constexpr uint8_t _clamp(uint8_t Value, uint8_t Max) { return (Value < Max) ? Value : Max; }
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Constructors and Conversions
+                * @{
+                */
+                    constexpr ShortMessage() noexcept : _Packed(0) {} ///< Constructs an empty message.
+
+                    /**
+                     * @brief Constructs a message from its raw bytes.
+                     *
+                     * The size is derived from the status byte. Data bytes beyond that size are ignored.
+                     *
+                     * @param Status The status byte.
+                     * @param Data1 The first data byte.
+                     * @param Data2 The second data byte.
+                     */
+                    explicit constexpr ShortMessage(uint8_t Status, uint8_t Data1 = 0, uint8_t Data2 = 0) noexcept
+                        : _Packed(Pack(Status, Data1, Data2, ExpectedSize(Status))) {}
+
+                    /**
+                     * @brief Converts a `Message` into a `ShortMessage`.
+                     *
+                     * Messages longer than three bytes (SysEx) produce an empty `ShortMessage`.
+                     */
+                    ShortMessage(const Message& Source) noexcept
+                        : _Packed((Source.size() > 0 && Source.size() <= 3)
+                                      ? Pack(Source.Data(0), Source.Data(1), Source.Data(2), static_cast<uint8_t>(Source.size()))
+                                      : 0) {}
+
+                    /**
+                     * @brief Converts the message into a `Message`.
+                     */
+                    operator Message() const {
+                        uint8_t bytes[3] = { Status(), Data1(), Data2() };
+                        Message msg;
+                        msg.SetRawData(bytes, size());
+                        return msg;
+                    }
+
+                    /**
+                     * @brief Reconstructs a message from its packed representation.
+                     * @param Packed Value previously returned by `Packed()`.
+                     */
+                    static constexpr ShortMessage FromPacked(uint32_t Packed) noexcept {
+                        ShortMessage msg;
+                        msg._Packed = Packed;
+                        return msg;
+                    }
+
+                    /**
+                     * @brief Packs raw bytes into the `ShortMessage` layout.
+                     */
+                    static constexpr uint32_t Pack(uint8_t Status, uint8_t Data1, uint8_t Data2, uint8_t Size) noexcept {
+                        return  static_cast<uint32_t>(Status)
+                             | (static_cast<uint32_t>((Size > 1) ? Data1 : 0) << 8)
+                             | (static_cast<uint32_t>((Size > 2) ? Data2 : 0) << 16)
+                             | (static_cast<uint32_t>(Size) << 24);
+                    }
+
+                    /**
+                     * @brief Returns the length of a short message given its status byte.
+                     * @return 1-3 for valid short message status bytes, 0 for data bytes and SysEx.
+                     */
+                    static constexpr uint8_t ExpectedSize(uint8_t Status) noexcept {
+                        return MidiProtocol::StatusTable[Status].Size;
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Data Access
+                * @{
+                */
+                    constexpr uint32_t Packed() const noexcept { return _Packed; }                                   ///< Returns the packed representation.
+                    constexpr uint8_t Status() const noexcept { return static_cast<uint8_t>(_Packed); }              ///< Returns the status byte.
+                    constexpr uint8_t Data1() const noexcept { return static_cast<uint8_t>(_Packed >> 8); }          ///< Returns the first data byte.
+                    constexpr uint8_t Data2() const noexcept { return static_cast<uint8_t>(_Packed >> 16); }         ///< Returns the second data byte.
+                    constexpr size_t size() const noexcept { return static_cast<size_t>(_Packed >> 24); }            ///< Returns the message size in bytes.
+                    constexpr uint8_t Channel() const noexcept { return Status() & 0x0F; }                           ///< Returns the channel of a Channel Voice message.
+                    constexpr uint8_t Command() const noexcept { return (Status() < 0xF0) ? (Status() & 0xF0) : Status(); } ///< Returns the status with the channel removed.
+
+                    /**
+                     * @brief Returns the byte stored at the specified index, or 0 when out of bounds.
+                     */
+                    constexpr uint8_t Data(size_t index) const noexcept {
+                        return (index < size()) ? static_cast<uint8_t>(_Packed >> (8 * index)) : 0;
+                    }
+
+                    /**
+                     * @brief Copies the message bytes into a caller provided buffer of at least 3 bytes.
+                     * @return The number of bytes written.
+                     */
+                    size_t CopyTo(uint8_t* Buffer) const noexcept {
+                        Buffer[0] = Status();
+                        Buffer[1] = Data1();
+                        Buffer[2] = Data2();
+                        return size();
+                    }
+
+                    constexpr bool operator==(const ShortMessage& Other) const noexcept { return _Packed == Other._Packed; }
+                    constexpr bool operator!=(const ShortMessage& Other) const noexcept { return _Packed != Other._Packed; }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Channel Voice Messages
+                * @brief Mirrors the `Message` Channel Voice builders. Out of range values are clamped.
+                * @{
+                */
+                    static constexpr ShortMessage NoteOff(uint8_t Pitch, uint8_t Vel = 0, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_NOTE_OFF + _clamp(Channel, 15), _clamp(Pitch, 127), _clamp(Vel, 127));
+                    }
+
+                    static constexpr ShortMessage NoteOn(uint8_t Pitch, uint8_t Vel, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_NOTE_ON + _clamp(Channel, 15), _clamp(Pitch, 127), _clamp(Vel, 127));
+                    }
+
+                    static constexpr ShortMessage AfterTouch(uint8_t Note, uint8_t Pressure, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_AFTER_TOUCH + _clamp(Channel, 15), _clamp(Note, 127), _clamp(Pressure, 127));
+                    }
+
+                    static constexpr ShortMessage ProgramChange(uint8_t Program, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_PROGRAM_CHANGE + _clamp(Channel, 15), _clamp(Program, 127));
+                    }
+
+                    static constexpr ShortMessage ChannelPressure(uint8_t Pressure, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_CHANNEL_PRESSURE + _clamp(Channel, 15), _clamp(Pressure, 127));
+                    }
+
+                    /**
+                     * @brief Pitch Bend from an unsigned 14-bit value (0-16383).
+                     */
+                    static constexpr ShortMessage PitchBend(uint16_t Value, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_PITCH_BEND + _clamp(Channel, 15),
+                                            static_cast<uint8_t>(((Value > 0x3FFF) ? 0x3FFF : Value) & 0x7F),
+                                            static_cast<uint8_t>((((Value > 0x3FFF) ? 0x3FFF : Value) >> 7) & 0x7F));
+                    }
+
+                    /**
+                     * @brief Pitch Bend from a signed 14-bit value (-8192 to 8191).
+                     */
+                    static constexpr ShortMessage PitchBend(int16_t Value, uint8_t Channel = 0) noexcept {
+                        return PitchBend(static_cast<uint16_t>(((Value < -8192) ? -8192 : (Value > 8191) ? 8191 : Value) + 8192), Channel);
+                    }
+
+                    /**
+                     * @brief Pitch Bend from an unsigned 7-bit value (0-127) scaled to 14 bits.
+                     */
+                    static constexpr ShortMessage PitchBend(uint8_t Value, uint8_t Channel = 0) noexcept {
+                        return PitchBend(static_cast<uint16_t>(static_cast<uint16_t>(Value) << 6), Channel);
+                    }
+
+                    /**
+                     * @brief Pitch Bend from a signed 7-bit value (-64 to 63) scaled to 14 bits.
+                     */
+                    static constexpr ShortMessage PitchBend(int8_t Value, uint8_t Channel = 0) noexcept {
+                        return PitchBend(static_cast<uint16_t>((Value >= 0) ? (8192 + (static_cast<uint16_t>(Value) << 6))
+                                                                            : (8192 - (static_cast<uint16_t>(-Value) << 6))), Channel);
+                    }
+
+                    static constexpr ShortMessage ControlChange(uint8_t ControllerNumber, uint8_t Value, uint8_t Channel = 0) noexcept {
+                        return ShortMessage(MIDI_CONTROL_CHANGE + _clamp(Channel, 15), _clamp(ControllerNumber, 127), _clamp(Value, 127));
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Control Change Helpers
+                * @brief Mirrors the `Message` CC helpers. Invalid channel mode values produce an empty message.
+                * @{
+                */
+                    static constexpr ShortMessage CC_BankSelect(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_BANK_SELECT, Value, Channel); }
+                    static constexpr ShortMessage CC_Modulation(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_MODULATION, Value, Channel); }
+                    static constexpr ShortMessage CC_BreathControl(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_BREATH_CONTROL, Value, Channel); }
+                    static constexpr ShortMessage CC_FootPedal(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_FOOT_PEDAL, Value, Channel); }
+                    static constexpr ShortMessage CC_Portamento(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_PORTAMENTO, Value, Channel); }
+                    static constexpr ShortMessage CC_Volume(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_VOLUME, Value, Channel); }
+                    static constexpr ShortMessage CC_Balance(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_BALANCE, Value, Channel); }
+                    static constexpr ShortMessage CC_Pan(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_PAN, Value, Channel); }
+                    static constexpr ShortMessage CC_Expression(uint8_t Value, uint8_t Channel = 0) noexcept { return ControlChange(MIDI_EXPRESSION, Value, Channel); }
+
+                    static constexpr ShortMessage CC_AllSoundOff(uint8_t Channel) noexcept { return ControlChange(MIDI_ALL_SOUND_OFF, 0x00, Channel); }
+                    static constexpr ShortMessage CC_AllNotesOff(uint8_t Channel) noexcept { return ControlChange(MIDI_ALL_NOTES_OFF, 0x00, Channel); }
+
+                    static constexpr ShortMessage CC_LocalControl(uint8_t Mode, uint8_t Channel) noexcept { return ControlChange(MIDI_LOCAL_CONTROL, Mode, Channel); }
+                    static constexpr ShortMessage CC_LocalControl(bool Mode, uint8_t Channel) noexcept {
+                        return CC_LocalControl(static_cast<uint8_t>(Mode ? MIDI_LOCAL_CONTROL_ON : MIDI_LOCAL_CONTROL_OFF), Channel);
+                    }
+                    static constexpr ShortMessage CC_LocalControl(const MidiProtocol::LocalControlStatus& Mode, uint8_t Channel) noexcept {
+                        return CC_LocalControl(static_cast<uint8_t>(Mode), Channel);
+                    }
+                    static constexpr ShortMessage CC_LocalControlOn(uint8_t Channel) noexcept { return CC_LocalControl(static_cast<uint8_t>(MIDI_LOCAL_CONTROL_ON), Channel); }
+                    static constexpr ShortMessage CC_LocalControlOff(uint8_t Channel) noexcept { return CC_LocalControl(static_cast<uint8_t>(MIDI_LOCAL_CONTROL_OFF), Channel); }
+
+                    static constexpr ShortMessage CC_OmniMode(uint8_t Mode, uint8_t Channel) noexcept {
+                        return (Mode == MIDI_OMNI_OFF || Mode == MIDI_OMNI_ON) ? ControlChange(Mode, 0, Channel) : ShortMessage();
+                    }
+                    static constexpr ShortMessage CC_OmniMode(bool Mode, uint8_t Channel) noexcept {
+                        return CC_OmniMode(static_cast<uint8_t>(Mode ? MIDI_OMNI_ON : MIDI_OMNI_OFF), Channel);
+                    }
+                    static constexpr ShortMessage CC_OmniMode(const MidiProtocol::ChannelMode& Mode, uint8_t Channel) noexcept {
+                        return CC_OmniMode(static_cast<uint8_t>(Mode), Channel);
+                    }
+                    static constexpr ShortMessage CC_OmniOn(uint8_t Channel) noexcept { return CC_OmniMode(static_cast<uint8_t>(MIDI_OMNI_ON), Channel); }
+                    static constexpr ShortMessage CC_OmniOff(uint8_t Channel) noexcept { return CC_OmniMode(static_cast<uint8_t>(MIDI_OMNI_OFF), Channel); }
+
+                    static constexpr ShortMessage CC_Polyphony(uint8_t Mode, uint8_t Channel) noexcept {
+                        return (Mode == MIDI_POLY_ON || Mode == MIDI_MONO_ON) ? ControlChange(Mode, 0, Channel) : ShortMessage();
+                    }
+                    static constexpr ShortMessage CC_Polyphony(bool Mode, uint8_t Channel) noexcept {
+                        return CC_Polyphony(static_cast<uint8_t>(Mode ? MIDI_POLY_ON : MIDI_MONO_ON), Channel);
+                    }
+                    static constexpr ShortMessage CC_Polyphony(const MidiProtocol::ChannelMode& Mode, uint8_t Channel) noexcept {
+                        return CC_Polyphony(static_cast<uint8_t>(Mode), Channel);
+                    }
+                    static constexpr ShortMessage CC_Mono(uint8_t Channel) noexcept { return CC_Polyphony(static_cast<uint8_t>(MIDI_MONO_ON), Channel); }
+                    static constexpr ShortMessage CC_Poly(uint8_t Channel) noexcept { return CC_Polyphony(static_cast<uint8_t>(MIDI_POLY_ON), Channel); }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Real Time Messages
+                * @{
+                */
+                    static constexpr ShortMessage TimingTick() noexcept { return ShortMessage(MIDI_REALTIME_TIMING_TICK); }
+                    static constexpr ShortMessage Start() noexcept { return ShortMessage(MIDI_REALTIME_START); }
+                    static constexpr ShortMessage Continue() noexcept { return ShortMessage(MIDI_REALTIME_CONTINUE); }
+                    static constexpr ShortMessage Stop() noexcept { return ShortMessage(MIDI_REALTIME_STOP); }
+                    static constexpr ShortMessage ActiveSensing() noexcept { return ShortMessage(MIDI_REALTIME_ACTIVE_SENSING); }
+                    static constexpr ShortMessage SystemReset() noexcept { return ShortMessage(MIDI_REALTIME_SYSTEM_RESET); }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name System Common Messages
+                * @{
+                */
+                    static constexpr ShortMessage MTC_QuarterFrame(uint8_t TimeComponent, uint8_t Data) noexcept {
+                        return ShortMessage(MIDI_MTC_QUARTER_FRAME, static_cast<uint8_t>(((TimeComponent & 0x07) << 4) | (Data & 0x0F)));
+                    }
+                    static constexpr ShortMessage MTC_QuarterFrame(const MidiProtocol_MTC::TimeComponent& TimeComponent, uint8_t Data) noexcept {
+                        return MTC_QuarterFrame(static_cast<uint8_t>(TimeComponent), Data);
+                    }
+                    static constexpr ShortMessage SongPositionPointer(uint16_t Position) noexcept {
+                        return ShortMessage(MIDI_SONG_POSITION_POINTER, static_cast<uint8_t>(Position & 0x7F), static_cast<uint8_t>((Position >> 7) & 0x7F));
+                    }
+                    static constexpr ShortMessage SongSelect(uint8_t Song) noexcept { return ShortMessage(MIDI_SONG_SELECT, static_cast<uint8_t>(Song & 0x7F)); }
+                    static constexpr ShortMessage TuningRequest() noexcept { return ShortMessage(MIDI_TUNING_REQUEST); }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_SHORT_MESSAGE_H
@@ -0,0 +1,115 @@
+#include "SysExWriter.h"
+
+namespace MIDILAR::MidiCore{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Construction and Output
+
+        SysExWriter::SysExWriter(uint8_t* ChunkBuffer, size_t ChunkSize)
+            : _Chunk(ChunkBuffer), _ChunkSize(ChunkBuffer ? ChunkSize : 0), _Fill(0), _Open(false) {}
+
+        void SysExWriter::BindOutput(CallbackType Callback) {
+            _Output.bind(Callback);
+        }
+
+        void SysExWriter::UnbindOutput() {
+            _Output.unbind();
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Streaming
+
+        void SysExWriter::_put(uint8_t Byte) {
+            _Chunk[_Fill++] = Byte;
+            if (_Fill == _ChunkSize) {
+                Flush();
+            }
+        }
+
+        bool SysExWriter::Begin() {
+            if (_ChunkSize == 0) {
+                return false; // No chunk buffer
+            }
+
+            _Fill = 0;
+            _Open = true;
+            _put(MIDI_SYSEX_START);
+            return true;
+        }
+
+        bool SysExWriter::Append(const uint8_t* Data, size_t Size) {
+            if (!_Open) {
+                return false;
+            }
+            if (Data == nullptr) {
+                return Size == 0;
+            }
+
+            while (Size > 0) {
+                size_t count = _ChunkSize - _Fill;
+                if (count > Size) {
+                    count = Size;
+                }
+
+                memcpy(_Chunk + _Fill, Data, count);
+                _Fill += count;
+                Data += count;
+                Size -= count;
+
+                if (_Fill == _ChunkSize) {
+                    Flush();
+                }
+            }
+            return true;
+        }
+
+        bool SysExWriter::AppendPacked7Bit(const uint8_t* Data, size_t Size) {
+            if (!_Open) {
+                return false;
+            }
+            if (Data == nullptr) {
+                return Size == 0;
+            }
+
+            uint8_t packed[Protocol::SysExCodec::Pack7BitSize(56)];
+            while (Size > 0) {
+                size_t count = (Size < 56) ? Size : 56; // Whole groups, so blocks pack like a single call
+                Append(packed, Protocol::SysExCodec::Pack7Bit(Data, count, packed));
+                Data += count;
+                Size -= count;
+            }
+            return true;
+        }
+
+        bool SysExWriter::End() {
+            if (!_Open) {
+                return false;
+            }
+
+            _put(MIDI_SYSEX_END);
+            Flush();
+            _Open = false;
+            return true;
+        }
+
+        bool SysExWriter::Write(const uint8_t* Payload, size_t Size) {
+            if (!Begin()) {
+                return false;
+            }
+            Append(Payload, Size);
+            return End();
+        }
+
+        void SysExWriter::Flush() {
+            if (_Fill > 0 && _Output.status()) {
+                _Output.invoke(_Chunk, _Fill);
+            }
+            _Fill = 0;
+        }
+
+        bool SysExWriter::IsOpen() const {
+            return _Open;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
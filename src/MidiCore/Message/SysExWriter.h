@@ -0,0 +1,139 @@
+#ifndef MIDILAR_MIDI_SYSEX_WRITER_H
+#define MIDILAR_MIDI_SYSEX_WRITER_H
+
+/**
+ * @file SysExWriter.h
+ * @brief Provides the `SysExWriter` class for streaming System Exclusive messages in fixed-size chunks.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <string.h>
+
+    #include <SystemCore/CallbackHandler/CallbackHandler.h>
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Protocol/SysExCodec.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class SysExWriter
+         * @brief Streams a System Exclusive message to an output callback in fixed-size chunks.
+         *
+         * The writer frames the payload with the SysEx start (0xF0) and end (0xF7) bytes and
+         * forwards it through a user-provided chunk buffer. Whenever the buffer fills up it is
+         * handed to the bound output callback, so arbitrarily large dumps can be sent without
+         * ever holding the complete message in memory.
+         *
+         * The chunk buffer is owned by the caller, following the `SystemCore::RingBuffer` model.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * uint8_t chunk[64];
+         * SysExWriter writer(chunk, sizeof(chunk));
+         * writer.BindOutput(SerialWrite);
+         *
+         * writer.Begin();
+         * writer.Append(header, sizeof(header));
+         * while (ReadNextBlock(block, &size)) {
+         *     writer.Append(block, size);
+         * }
+         * writer.End();
+         * ```
+         */
+            class SysExWriter {
+
+            public:
+                using CallbackType = MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t>::CallbackType; ///< Output callback type.
+
+            private:
+                MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _Output; ///< Receives each finished chunk.
+                uint8_t* _Chunk;        ///< Caller-provided chunk buffer.
+                size_t _ChunkSize;      ///< Capacity of the chunk buffer.
+                size_t _Fill;           ///< Bytes currently waiting in the chunk buffer.
+                bool _Open;             ///< True between `Begin()` and `End()`.
+
+                void _put(uint8_t Byte);
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Construction and Output
+                * @{
+                */
+                    /**
+                     * @brief Constructs a writer using a caller-provided chunk buffer.
+                     * @param ChunkBuffer Storage for one chunk. Must outlive the writer.
+                     * @param ChunkSize Size of the chunk buffer in bytes. Each output call carries at most this many bytes.
+                     */
+                    SysExWriter(uint8_t* ChunkBuffer, size_t ChunkSize);
+
+                    void BindOutput(CallbackType Callback); ///< Binds a standalone output callback.
+
+                    /**
+                     * @brief Binds an instance method as output callback.
+                     * @tparam T Class type of the instance.
+                     * @tparam Method Member function to bind.
+                     * @param instance Pointer to the instance that owns the method.
+                     */
+                    template <typename T, void (T::*Method)(const uint8_t*, size_t)>
+                    inline void BindOutput(T* instance) {
+                        _Output.bind<T, Method>(instance);
+                    }
+
+                    void UnbindOutput(); ///< Unbinds the output callback.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Streaming
+                * @{
+                */
+                    /**
+                     * @brief Starts a new SysEx message. Any unfinished message is discarded.
+                     * @return False if the chunk buffer is invalid.
+                     */
+                    bool Begin();
+
+                    /**
+                     * @brief Appends payload bytes, flushing every full chunk to the output.
+                     * @return False if no message is open.
+                     */
+                    bool Append(const uint8_t* Data, size_t Size);
+
+                    /**
+                     * @brief Appends 8-bit data using 7-in-8 packing ("MSB byte first").
+                     *
+                     * The data is packed in small blocks on the stack while streaming. Splitting a payload
+                     * across calls gives the same result as one call only when every call but the last
+                     * carries a multiple of 7 bytes.
+                     * @see MIDILAR::MidiCore::Protocol::SysExCodec::Pack7Bit
+                     * @return False if no message is open.
+                     */
+                    bool AppendPacked7Bit(const uint8_t* Data, size_t Size);
+
+                    /**
+                     * @brief Closes the message with 0xF7 and flushes the last chunk.
+                     * @return False if no message is open.
+                     */
+                    bool End();
+
+                    /**
+                     * @brief Writes a complete message: `Begin()`, `Append()` and `End()` in one call.
+                     * @return False if the chunk buffer is invalid.
+                     */
+                    bool Write(const uint8_t* Payload, size_t Size);
+
+                    void Flush();           ///< Sends the bytes waiting in the chunk buffer, if any.
+                    bool IsOpen() const;    ///< Returns true while a message is being written.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_SYSEX_WRITER_H
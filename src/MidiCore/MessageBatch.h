@@ -0,0 +1,11 @@
+#ifndef MIDILAR_MIDI_MESSAGE_BATCH_H
+#define MIDILAR_MIDI_MESSAGE_BATCH_H
+
+    #include <MIDILAR_BuildSettings.h>
+    
+    #if __has_include(<MidiCore/MessageBatch/MessageBatch.h>)
+        #define MIDILAR_MIDI_MESSAGE_BATCH
+        #include <MidiCore/MessageBatch/MessageBatch.h>
+    #endif
+
+#endif//MIDILAR_MIDI_MESSAGE_BATCH_H
\ No newline at end of file
@@ -0,0 +1,330 @@
+#include "MessageBatch.h"
+
+namespace MIDILAR::MidiCore{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Private storage methods
+
+        uint8_t* MessageBatch::_allocate(size_t Size) {
+            if (_DataSize + Size > UINT32_MAX) {
+                return nullptr; // Offsets would overflow
+            }
+
+            if (_DataSize + Size > _DataCapacity || _Count == _OffsetCapacity) {
+                size_t new_bytes = _DataCapacity;
+                while (new_bytes < _DataSize + Size) {
+                    new_bytes = (new_bytes == 0) ? 64 : new_bytes * 2;
+                }
+
+                size_t new_count = (_Count < _OffsetCapacity) ? _OffsetCapacity : ((_OffsetCapacity == 0) ? 16 : _OffsetCapacity * 2);
+
+                if (!Reserve(new_bytes, new_count)) {
+                    return nullptr; // Memory allocation failed
+                }
+            }
+
+            uint8_t* dest = _Data + _DataSize;
+            _Offsets[_Count++] = static_cast<uint32_t>(_DataSize);
+            _DataSize += Size;
+            return dest;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors and Assignment Operators
+
+        MessageBatch::MessageBatch() noexcept
+            : _Data(nullptr), _DataSize(0), _DataCapacity(0),
+              _Offsets(nullptr), _Count(0), _OffsetCapacity(0) {}
+
+        MessageBatch::MessageBatch(size_t ByteCapacity, size_t MessageCapacity) : MessageBatch() {
+            Reserve(ByteCapacity, MessageCapacity);
+        }
+
+        MessageBatch::MessageBatch(const MessageBatch& Source) : MessageBatch() {
+            *this = Source;
+        }
+
+        MessageBatch::MessageBatch(MessageBatch&& Source) noexcept : MessageBatch() {
+            *this = static_cast<MessageBatch&&>(Source);
+        }
+
+        MessageBatch::~MessageBatch() {
+            free(_Data);
+            free(_Offsets);
+        }
+
+        MessageBatch& MessageBatch::operator=(const MessageBatch& Source) {
+            if (this == &Source) {
+                return *this;
+            }
+
+            Clear();
+            if (!Reserve(Source._DataSize, Source._Count)) {
+                return *this; // Memory allocation failed, leave the batch empty
+            }
+
+            if (Source._DataSize > 0) {
+                memcpy(_Data, Source._Data, Source._DataSize);
+                memcpy(_Offsets, Source._Offsets, Source._Count * sizeof(uint32_t));
+            }
+            _DataSize = Source._DataSize;
+            _Count = Source._Count;
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::operator=(MessageBatch&& Source) noexcept {
+            if (this == &Source) {
+                return *this;
+            }
+
+            free(_Data);
+            free(_Offsets);
+
+            _Data = Source._Data;
+            _DataSize = Source._DataSize;
+            _DataCapacity = Source._DataCapacity;
+            _Offsets = Source._Offsets;
+            _Count = Source._Count;
+            _OffsetCapacity = Source._OffsetCapacity;
+
+            Source._Data = nullptr;
+            Source._DataSize = 0;
+            Source._DataCapacity = 0;
+            Source._Offsets = nullptr;
+            Source._Count = 0;
+            Source._OffsetCapacity = 0;
+            return *this;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Capacity
+
+        bool MessageBatch::Reserve(size_t ByteCapacity, size_t MessageCapacity) {
+            if (ByteCapacity > _DataCapacity) {
+                uint8_t* new_data = (uint8_t*)realloc(_Data, ByteCapacity * sizeof(uint8_t));
+                if (new_data == nullptr) {
+                    return false; // Memory allocation failed
+                }
+                _Data = new_data;
+                _DataCapacity = ByteCapacity;
+            }
+
+            if (MessageCapacity > _OffsetCapacity) {
+                uint32_t* new_offsets = (uint32_t*)realloc(_Offsets, MessageCapacity * sizeof(uint32_t));
+                if (new_offsets == nullptr) {
+                    return false; // Memory allocation failed
+                }
+                _Offsets = new_offsets;
+                _OffsetCapacity = MessageCapacity;
+            }
+
+            return true;
+        }
+
+        void MessageBatch::Clear() {
+            _DataSize = 0;
+            _Count = 0;
+        }
+
+        size_t MessageBatch::size() const {
+            return _Count;
+        }
+
+        size_t MessageBatch::ByteSize() const {
+            return _DataSize;
+        }
+
+        bool MessageBatch::empty() const {
+            return _Count == 0;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Data Access
+
+        const uint8_t* MessageBatch::Buffer() const {
+            return (_DataSize > 0) ? _Data : nullptr;
+        }
+
+        MessageBatch::View MessageBatch::operator[](size_t index) const {
+            if (index >= _Count) {
+                return View();
+            }
+
+            size_t start = _Offsets[index];
+            size_t stop = (index + 1 < _Count) ? _Offsets[index + 1] : _DataSize;
+            return View(_Data + start, stop - start);
+        }
+
+        MessageBatch::const_iterator MessageBatch::begin() const {
+            return const_iterator(this, 0);
+        }
+
+        MessageBatch::const_iterator MessageBatch::end() const {
+            return const_iterator(this, _Count);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Append
+
+        bool MessageBatch::Append(const uint8_t* Data, size_t Size) {
+            if (Data == nullptr || Size == 0) {
+                return false; // No data to append
+            }
+
+            uint8_t* dest = _allocate(Size);
+            if (dest == nullptr) {
+                return false; // Memory allocation failed
+            }
+
+            memcpy(dest, Data, Size);
+            return true;
+        }
+
+        bool MessageBatch::Append(const Message& Source) {
+            return Append(Source.Buffer(), Source.size());
+        }
+
+        bool MessageBatch::Append(const ShortMessage& Source) {
+            if (Source.size() == 0) {
+                return false; // Empty message
+            }
+
+            uint8_t* dest = _allocate(Source.size());
+            if (dest == nullptr) {
+                return false; // Memory allocation failed
+            }
+
+            for (size_t i = 0; i < Source.size(); i++) {
+                dest[i] = Source.Data(i);
+            }
+            return true;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Message Builders
+
+        MessageBatch& MessageBatch::NoteOff(uint8_t Pitch, uint8_t Vel, uint8_t Channel) {
+            Append(ShortMessage::NoteOff(Pitch, Vel, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::NoteOn(uint8_t Pitch, uint8_t Vel, uint8_t Channel) {
+            Append(ShortMessage::NoteOn(Pitch, Vel, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::AfterTouch(uint8_t Note, uint8_t Pressure, uint8_t Channel) {
+            Append(ShortMessage::AfterTouch(Note, Pressure, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::ProgramChange(uint8_t Program, uint8_t Channel) {
+            Append(ShortMessage::ProgramChange(Program, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::ChannelPressure(uint8_t Pressure, uint8_t Channel) {
+            Append(ShortMessage::ChannelPressure(Pressure, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::PitchBend(int8_t Value, uint8_t Channel) {
+            Append(ShortMessage::PitchBend(Value, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::PitchBend(int16_t Value, uint8_t Channel) {
+            Append(ShortMessage::PitchBend(Value, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::PitchBend(uint8_t Value, uint8_t Channel) {
+            Append(ShortMessage::PitchBend(Value, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::PitchBend(uint16_t Value, uint8_t Channel) {
+            Append(ShortMessage::PitchBend(Value, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::ControlChange(uint8_t ControllerNumber, uint8_t Value, uint8_t Channel) {
+            Append(ShortMessage::ControlChange(ControllerNumber, Value, Channel));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::TimingTick() {
+            Append(ShortMessage::TimingTick());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::Start() {
+            Append(ShortMessage::Start());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::Continue() {
+            Append(ShortMessage::Continue());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::Stop() {
+            Append(ShortMessage::Stop());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::ActiveSensing() {
+            Append(ShortMessage::ActiveSensing());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::SystemReset() {
+            Append(ShortMessage::SystemReset());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::MTC_QuarterFrame(uint8_t TimeComponent, uint8_t Data) {
+            Append(ShortMessage::MTC_QuarterFrame(TimeComponent, Data));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::SongPositionPointer(uint16_t Position) {
+            Append(ShortMessage::SongPositionPointer(Position));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::SongSelect(uint8_t Song) {
+            Append(ShortMessage::SongSelect(Song));
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::TuningRequest() {
+            Append(ShortMessage::TuningRequest());
+            return *this;
+        }
+
+        MessageBatch& MessageBatch::SystemExclusive(const uint8_t* Data, size_t Length) {
+            if (Data == nullptr || Length == 0) {
+                return *this; // No data to process
+            }
+
+            bool add_start = (Data[0] != MIDI_SYSEX_START);
+            bool add_end = (Data[Length - 1] != MIDI_SYSEX_END);
+
+            uint8_t* dest = _allocate(Length + add_start + add_end);
+            if (dest == nullptr) {
+                return *this; // Memory allocation failed
+            }
+
+            if (add_start) {
+                *dest++ = MIDI_SYSEX_START;
+            }
+            memcpy(dest, Data, Length);
+            if (add_end) {
+                dest[Length] = MIDI_SYSEX_END;
+            }
+            return *this;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
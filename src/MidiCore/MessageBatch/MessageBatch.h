@@ -0,0 +1,196 @@
+#ifndef MIDILAR_MIDI_MESSAGE_BATCH_H
+#define MIDILAR_MIDI_MESSAGE_BATCH_H
+
+/**
+ * @file MessageBatch.h
+ * @brief Provides the `MessageBatch` container for storing many MIDI messages back to back.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Message/Message.h>
+    #include <MidiCore/Message/ShortMessage.h>
+    #include <MidiCore/Message/MessageView.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class MessageBatch
+         * @brief Stores a sequence of MIDI messages in a single contiguous byte arena.
+         *
+         * Messages are appended back to back into one growable buffer, while a compact
+         * offset index records where each message starts. Appending a message never
+         * allocates per message; the arena and the index grow geometrically and are reused
+         * after `Clear()`.
+         *
+         * Because the arena holds a valid MIDI byte stream, the whole batch can be handed to
+         * `MessageParser::ProcessData` in a single call. Iterating the batch yields non-owning
+         * `MessageView` objects that point into the arena.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * MessageBatch batch;
+         * batch.NoteOn(60, 100).NoteOn(64, 100).NoteOn(67, 100);
+         * batch.Append(ShortMessage::CC_Volume(90));
+         *
+         * for (const MessageBatch::View& msg : batch) {
+         *     Send(msg.Buffer(), msg.size());
+         * }
+         * ```
+         *
+         * @note Offsets are stored as `uint32_t`, limiting a batch to 4 GiB of MIDI data.
+         *
+         * @see MIDILAR::MidiCore::Message
+         * @see MIDILAR::MidiCore::ShortMessage
+         */
+            class MessageBatch {
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @brief Non-owning view of a single message stored in a `MessageBatch`.
+                *
+                * A view stays valid until the batch is modified or destroyed.
+                */
+                    using View = MessageView;
+               //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @class const_iterator
+                * @brief Forward iterator over the messages of a `MessageBatch`.
+                */
+                    class const_iterator {
+                    private:
+                        const MessageBatch* _Batch;
+                        size_t _Index;
+
+                    public:
+                        const_iterator(const MessageBatch* Batch, size_t Index) : _Batch(Batch), _Index(Index) {}
+
+                        View operator*() const { return (*_Batch)[_Index]; }
+                        const_iterator& operator++() { ++_Index; return *this; }
+                        const_iterator operator++(int) { const_iterator tmp = *this; ++_Index; return tmp; }
+                        bool operator==(const const_iterator& Other) const { return _Index == Other._Index && _Batch == Other._Batch; }
+                        bool operator!=(const const_iterator& Other) const { return !(*this == Other); }
+                    };
+               //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            private:
+                uint8_t* _Data;            ///< Byte arena holding every message back to back.
+                size_t _DataSize;          ///< Number of bytes in use in the arena.
+                size_t _DataCapacity;      ///< Allocated size of the arena.
+                uint32_t* _Offsets;        ///< Start offset of each message in the arena.
+                size_t _Count;             ///< Number of messages stored.
+                size_t _OffsetCapacity;    ///< Allocated length of the offset index.
+
+                uint8_t* _allocate(size_t Size); ///< Reserves `Size` bytes for a new message and returns where to write them.
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Constructors and Assignment Operators
+                * @{
+                */
+                    MessageBatch() noexcept;                                ///< Default constructor, allocates nothing.
+                    MessageBatch(size_t ByteCapacity, size_t MessageCapacity); ///< Constructs a batch with reserved storage.
+                    MessageBatch(const MessageBatch& Source);               ///< Copy constructor.
+                    MessageBatch(MessageBatch&& Source) noexcept;           ///< Move constructor.
+                    ~MessageBatch();                                        ///< Destructor.
+
+                    MessageBatch& operator=(const MessageBatch& Source);
+                    MessageBatch& operator=(MessageBatch&& Source) noexcept;
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Capacity
+                * @{
+                */
+                    /**
+                     * @brief Reserves storage for the given number of bytes and messages.
+                     * @return False if memory allocation failed.
+                     */
+                    bool Reserve(size_t ByteCapacity, size_t MessageCapacity);
+
+                    void Clear();                 ///< Removes every message, keeping the allocated storage.
+                    size_t size() const;          ///< Returns the number of messages stored.
+                    size_t ByteSize() const;      ///< Returns the total number of bytes stored.
+                    bool empty() const;           ///< Returns true if the batch holds no messages.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Data Access
+                * @{
+                */
+                    const uint8_t* Buffer() const;      ///< Returns a pointer to the contiguous byte stream, or nullptr when empty.
+                    View operator[](size_t index) const; ///< Returns a view of the message at the specified index.
+
+                    const_iterator begin() const;       ///< Returns an iterator to the first message.
+                    const_iterator end() const;         ///< Returns an iterator past the last message.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Append
+                * @brief Copies a complete message to the end of the batch.
+                * @return False if the message is empty or memory allocation failed.
+                * @{
+                */
+                    bool Append(const uint8_t* Data, size_t Size);
+                    bool Append(const Message& Source);
+                    bool Append(const ShortMessage& Source);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Message Builders
+                * @brief Append-style builders matching the `Message` builders.
+                *
+                * Each builder appends one message and returns a reference to the batch for chaining.
+                * Other short messages, such as the `CC_*` helpers, can be appended through
+                * `Append(ShortMessage::CC_Volume(...))`.
+                * @{
+                */
+                    MessageBatch& NoteOff(uint8_t Pitch, uint8_t Vel = 0, uint8_t Channel = 0);
+                    MessageBatch& NoteOn(uint8_t Pitch, uint8_t Vel, uint8_t Channel = 0);
+                    MessageBatch& AfterTouch(uint8_t Note, uint8_t Pressure, uint8_t Channel = 0);
+                    MessageBatch& ProgramChange(uint8_t Program, uint8_t Channel = 0);
+                    MessageBatch& ChannelPressure(uint8_t Pressure, uint8_t Channel = 0);
+                    MessageBatch& PitchBend(int8_t Value, uint8_t Channel = 0);
+                    MessageBatch& PitchBend(int16_t Value, uint8_t Channel = 0);
+                    MessageBatch& PitchBend(uint8_t Value, uint8_t Channel = 0);
+                    MessageBatch& PitchBend(uint16_t Value, uint8_t Channel = 0);
+                    MessageBatch& ControlChange(uint8_t ControllerNumber, uint8_t Value, uint8_t Channel = 0);
+
+                    MessageBatch& TimingTick();
+                    MessageBatch& Start();
+                    MessageBatch& Continue();
+                    MessageBatch& Stop();
+                    MessageBatch& ActiveSensing();
+                    MessageBatch& SystemReset();
+
+                    MessageBatch& MTC_QuarterFrame(uint8_t TimeComponent, uint8_t Data);
+                    MessageBatch& SongPositionPointer(uint16_t Position);
+                    MessageBatch& SongSelect(uint8_t Song);
+                    MessageBatch& TuningRequest();
+
+                    /**
+                     * @brief Appends a System Exclusive message.
+                     *
+                     * The start (0xF0) and end (0xF7) bytes are added when missing.
+                     */
+                    MessageBatch& SystemExclusive(const uint8_t* Data, size_t Length);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_MESSAGE_BATCH_H
@@ -6,6 +6,8 @@
     #if __has_include(<MidiCore/MessageParser/MessageParser.h>)
         #define MIDILAR_MIDI_MESSAGE_PARSER
         #include <MidiCore/MessageParser/MessageParser.h>
+        #include <MidiCore/MessageParser/ParserBank.h>
+        #include <MidiCore/MessageParser/BasicMessageParser.h>
     #endif
 
 #endif//MIDILAR_MIDI_MESSAGE_PARSER_H
\ No newline at end of file
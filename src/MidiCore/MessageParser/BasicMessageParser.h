@@ -0,0 +1,148 @@
+#ifndef MIDILAR_MIDI_BASIC_MESSAGE_PARSER_H
+#define MIDILAR_MIDI_BASIC_MESSAGE_PARSER_H
+
+#include <MIDILAR_BuildSettings.h>
+#include <MidiCore/Message/Message.h>
+#include <MidiCore/Protocol/StatusTable.h>
+#include <MidiCore/Protocol/Scan.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace MIDILAR::MidiCore {
+
+    /// \cond INTERNAL
+    namespace BasicMessageParserDetail {
+
+        // Reference to a T in unevaluated expressions, without requiring <utility> for std::declval
+        template <typename T>
+        T& DeclareRef() noexcept;
+
+        // Detects whether a handler callback can be called with the message bytes, so missing ones cost
+        // nothing at run time. Testing the call rather than `&H::Method` also accepts overloaded and
+        // templated members.
+        #define MIDILAR_PARSER_HANDLER_TRAIT(Method)                                                     \
+            template <typename H, typename = void>                                                      \
+            struct Has##Method { static constexpr bool value = false; };                                \
+            template <typename H>                                                                       \
+            struct Has##Method<H, decltype(static_cast<void>(DeclareRef<H>().Method(                    \
+                static_cast<const uint8_t*>(nullptr), static_cast<size_t>(0))))> { static constexpr bool value = true; };
+
+        MIDILAR_PARSER_HANDLER_TRAIT(OnChannelVoice)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnControlChange)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnRealTime)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnSystemCommon)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnMTC)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnSysEx)
+        MIDILAR_PARSER_HANDLER_TRAIT(OnDefault)
+
+        #undef MIDILAR_PARSER_HANDLER_TRAIT
+    }
+    /// \endcond
+
+    /**
+     * @class BasicMessageParser
+     * @brief Message parser whose callbacks are member functions of a handler known at compile time.
+     *
+     * `MessageParser` binds its callbacks at run time: every message goes through a `CallbackHandler`
+     * indirection and a `status()` check per category in its fallback chain. When the receiver is
+     * fixed, as in a device that always handles the same messages, this parser calls the handler
+     * directly instead. Calls can be inlined, and categories the handler does not declare are
+     * resolved at compile time: they fall back along the same chains as `MessageParser`, or vanish
+     * from the generated code when nothing in the chain is declared.
+     *
+     * The handler declares any of the following public members, each taking `(const uint8_t* Data, size_t Size)`:
+     * - `OnControlChange`, falling back to `OnChannelVoice`, then `OnDefault`
+     * - `OnChannelVoice`, falling back to `OnDefault`
+     * - `OnMTC` (Quarter Frame), falling back to `OnSystemCommon`, then `OnDefault`
+     * - `OnSystemCommon`, falling back to `OnDefault`
+     * - `OnSysEx`, falling back to `OnDefault`
+     * - `OnRealTime`, falling back to `OnDefault`
+     *
+     * Running status and Real-Time bytes inside other messages are handled as in `MessageParser`.
+     * The message buffer is part of the object: SysEx messages longer than `BufferSize` are dropped.
+     *
+     * ## Example Usage:
+     * ```cpp
+     * struct Synth {
+     *     void OnChannelVoice(const uint8_t* Data, size_t Size) { Voices.Handle(Data, Size); }
+     * };
+     *
+     * Synth synth;
+     * BasicMessageParser<Synth> parser(synth); // Everything but Channel Voice is skipped
+     * parser.ProcessData(input, length);
+     * ```
+     *
+     * @tparam Handler Type receiving the messages.
+     * @tparam BufferSize Size of the message buffer in bytes; 3 holds every message but SysEx.
+     */
+    template <typename Handler, size_t BufferSize = 3>
+    class BasicMessageParser {
+        static_assert(BufferSize >= 3, "BasicMessageParser needs room for a three byte message");
+
+    private:
+        /**
+         * @brief Internal parser state.
+         */
+        enum class Status : uint8_t {
+            Idle,               /**< Waiting for a status byte, or data bytes under running status. */
+            Processing,         /**< Accumulating a Channel Voice or System Common message. */
+            ProcessingSysex     /**< Accumulating a SysEx message. */
+        };
+
+        Handler& _Handler;
+        Status _Status;
+        size_t _MessageSize;                /**< Bytes stored in `_MessageBuffer`. */
+        uint8_t _Expected;                  /**< Complete size of the message in progress, 0 for SysEx. */
+        uint8_t _RunningStatus;             /**< Channel Voice status byte in effect, 0 when none. */
+        bool _RunningStatusEnabled;
+        uint8_t _MessageBuffer[BufferSize];
+
+        void _ChannelVoice(const uint8_t* data, size_t size);
+        void _ControlChange(const uint8_t* data, size_t size);
+        void _SystemCommon(const uint8_t* data, size_t size);
+        void _MTC(const uint8_t* data, size_t size);
+        void _SysEx(const uint8_t* data, size_t size);
+        void _RealTime(const uint8_t* data, size_t size);
+        void _Default(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Dispatches a complete message to the handler member selected at compile time.
+         */
+        void _Dispatch(const uint8_t* data, size_t size);
+
+    public:
+        /**
+         * @brief Constructs a parser delivering messages to `Target`.
+         * @param Target Handler receiving the messages. It must outlive the parser.
+         */
+        explicit BasicMessageParser(Handler& Target) noexcept;
+
+        /**
+         * @brief Enables or disables running status decoding, see `MessageParser::SetRunningStatus`.
+         */
+        void SetRunningStatus(bool Enabled);
+
+        /**
+         * @brief Returns true if running status decoding is enabled.
+         */
+        bool RunningStatusEnabled() const { return _RunningStatusEnabled; }
+
+        /**
+         * @brief Clears the running status and discards any partially received message.
+         */
+        void Reset();
+
+        /**
+         * @brief Processes a block of raw MIDI data.
+         * @param data Pointer to the raw MIDI data buffer.
+         * @param size Number of bytes available in the buffer.
+         */
+        void ProcessData(const uint8_t* data, size_t size);
+    };
+
+}
+
+#include "BasicMessageParser.tpp"
+
+#endif // MIDILAR_MIDI_BASIC_MESSAGE_PARSER_H
@@ -0,0 +1,203 @@
+#include "BasicMessageParser.h"
+
+namespace MIDILAR::MidiCore {
+
+    template <typename Handler, size_t BufferSize>
+    BasicMessageParser<Handler, BufferSize>::BasicMessageParser(Handler& Target) noexcept
+        : _Handler(Target),
+          _Status(Status::Idle),
+          _MessageSize(0),
+          _Expected(0),
+          _RunningStatus(0),
+          _RunningStatusEnabled(false)
+    {
+    }
+
+    template <typename Handler, size_t BufferSize>
+    void BasicMessageParser<Handler, BufferSize>::SetRunningStatus(bool Enabled) {
+        _RunningStatusEnabled = Enabled;
+        _RunningStatus = 0;
+    }
+
+    template <typename Handler, size_t BufferSize>
+    void BasicMessageParser<Handler, BufferSize>::Reset() {
+        _Status = Status::Idle;
+        _MessageSize = 0;
+        _RunningStatus = 0;
+    }
+
+    template <typename Handler, size_t BufferSize>
+    void BasicMessageParser<Handler, BufferSize>::ProcessData(const uint8_t* data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            uint8_t byte = data[i];
+
+            // Data byte: append it and dispatch once the message reaches the size set by its status byte
+            if (byte < 0x80) {
+                if (_Status == Status::ProcessingSysex) {
+                    size_t run = MidiProtocol::Scan::DataRunLength(data + i, size - i);
+                    if (run > BufferSize - _MessageSize) {
+                        _Status = Status::Idle; // Buffer Overflow
+                        _MessageSize = 0;
+                    } else {
+                        memcpy(_MessageBuffer + _MessageSize, data + i, run);
+                        _MessageSize += run;
+                    }
+                    i += run - 1;
+                    continue;
+                }
+
+                if (_Status == Status::Idle) {
+                    if (_RunningStatus == 0) {
+                        i += MidiProtocol::Scan::DataRunLength(data + i, size - i) - 1;
+                        continue; // No status in effect, drop the bytes up to the next status byte
+                    }
+                    _MessageBuffer[0] = _RunningStatus;
+                    _MessageSize = 1;
+                    _Expected = MidiProtocol::StatusTable[_RunningStatus].Size;
+                    _Status = Status::Processing;
+                }
+
+                _MessageBuffer[_MessageSize++] = byte;
+                if (_MessageSize == _Expected) {
+                    _Dispatch(_MessageBuffer, _MessageSize);
+                    _Status = Status::Idle;
+                    _MessageSize = 0;
+                }
+                continue;
+            }
+
+            const MidiProtocol::StatusInfo& info = MidiProtocol::StatusTable[byte];
+
+            // Real-Time bytes may appear anywhere, even inside another message
+            if (byte >= MIDI_REALTIME_TIMING_TICK) {
+                if (info.Category == MidiProtocol::MessageCategory::RealTime) {
+                    _RealTime(data + i, 1);
+                }
+                continue;
+            }
+
+            if (byte == MIDI_SYSEX_END && _Status == Status::ProcessingSysex) {
+                if (_MessageSize < BufferSize) {
+                    _MessageBuffer[_MessageSize++] = byte;
+                    _SysEx(_MessageBuffer, _MessageSize);
+                }
+                _Status = Status::Idle;
+                _MessageSize = 0;
+                continue;
+            }
+
+            // Any other status byte ends the message in progress and starts a new one
+            _RunningStatus = (_RunningStatusEnabled && byte < MIDI_SYSEX_START) ? byte : 0;
+            _Status = Status::Idle;
+            _MessageSize = 0;
+
+            if (byte == MIDI_SYSEX_START) {
+                _MessageBuffer[0] = byte;
+                _MessageSize = 1;
+                _Expected = 0;
+                _Status = Status::ProcessingSysex;
+                continue;
+            }
+
+            if (info.Size == 0) {
+                continue; // Undefined status bytes (0xF4, 0xF5) and 0xF7 outside a SysEx
+            }
+
+            // Fast path: the complete message is in the input, dispatch it in place
+            if (info.Size <= size - i && (info.Size < 2 || data[i + 1] < 0x80) && (info.Size < 3 || data[i + 2] < 0x80)) {
+                _Dispatch(data + i, info.Size);
+                i += info.Size - 1;
+                continue;
+            }
+
+            _MessageBuffer[0] = byte;
+            _MessageSize = 1;
+            _Expected = info.Size;
+            _Status = Status::Processing;
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    void BasicMessageParser<Handler, BufferSize>::_Dispatch(const uint8_t* data, size_t size) {
+        const MidiProtocol::StatusInfo& info = MidiProtocol::StatusTable[data[0]];
+
+        if (info.Category == MidiProtocol::MessageCategory::ChannelVoice) {
+            if (info.Kind == MidiProtocol::MessageKind::ControlChange) {
+                _ControlChange(data, size);
+            } else {
+                _ChannelVoice(data, size);
+            }
+        } else if (info.Kind == MidiProtocol::MessageKind::MTCQuarterFrame) {
+            _MTC(data, size);
+        } else {
+            _SystemCommon(data, size);
+        }
+    }
+
+    // Each category calls its handler member when it is declared, and the next one in its chain otherwise
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_ControlChange(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnControlChange<Handler>::value) {
+            _Handler.OnControlChange(data, size);
+        } else {
+            _ChannelVoice(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_ChannelVoice(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnChannelVoice<Handler>::value) {
+            _Handler.OnChannelVoice(data, size);
+        } else {
+            _Default(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_MTC(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnMTC<Handler>::value) {
+            _Handler.OnMTC(data, size);
+        } else {
+            _SystemCommon(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_SystemCommon(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnSystemCommon<Handler>::value) {
+            _Handler.OnSystemCommon(data, size);
+        } else {
+            _Default(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_SysEx(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnSysEx<Handler>::value) {
+            _Handler.OnSysEx(data, size);
+        } else {
+            _Default(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_RealTime(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnRealTime<Handler>::value) {
+            _Handler.OnRealTime(data, size);
+        } else {
+            _Default(data, size);
+        }
+    }
+
+    template <typename Handler, size_t BufferSize>
+    inline void BasicMessageParser<Handler, BufferSize>::_Default(const uint8_t* data, size_t size) {
+        if constexpr (BasicMessageParserDetail::HasOnDefault<Handler>::value) {
+            _Handler.OnDefault(data, size);
+        } else {
+            static_cast<void>(data); // Not handled: compiled away
+            static_cast<void>(size);
+        }
+    }
+
+}
@@ -1,7 +1,126 @@
 #include "MessageParser.h"
+#include <MidiCore/Protocol/Scan.h>
+#include <string.h>
+
+// Statements only compiled in when the parser counters are enabled
+#if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+    #define MIDILAR_PARSER_COUNT(Statement) Statement
+#else
+    #define MIDILAR_PARSER_COUNT(Statement)
+#endif
 
 namespace MIDILAR::MidiCore {
 
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Status Routing Table
+
+        /**
+         * @brief Callback chain a complete message is dispatched to.
+         */
+        enum _Route : uint8_t {
+            _RouteNone = 0,         ///< Not the start of a message.
+            _RouteControlChange,    ///< Control Change, then Channel Voice, then default.
+            _RouteChannelVoice,     ///< Channel Voice, then default.
+            _RouteMTC,              ///< MIDI Time Code, then System Common, then default.
+            _RouteSystemCommon,     ///< System Common, then default.
+            _RouteSysEx,            ///< System Exclusive, then default.
+            _RouteRealTime          ///< Real-Time, then default.
+        };
+
+        /**
+         * @brief Parsing information of a single status byte.
+         */
+        struct _StatusRoute {
+            uint8_t Size;   ///< Complete message size, 0 for SysEx and bytes that do not start a message.
+            uint8_t Route;  ///< `_Route` of the message.
+        };
+
+        constexpr _StatusRoute _ClassifyRoute(uint8_t Status) {
+            const MidiProtocol::StatusInfo& info = MidiProtocol::StatusTable[Status];
+
+            switch (info.Category) {
+                case MidiProtocol::MessageCategory::ChannelVoice:
+                    return {info.Size, (info.Kind == MidiProtocol::MessageKind::ControlChange) ? _RouteControlChange : _RouteChannelVoice};
+                case MidiProtocol::MessageCategory::SystemCommon:
+                    return {info.Size, (info.Kind == MidiProtocol::MessageKind::MTCQuarterFrame) ? _RouteMTC : _RouteSystemCommon};
+                case MidiProtocol::MessageCategory::SystemExclusive:
+                    return {0, (info.Kind == MidiProtocol::MessageKind::SysExStart) ? _RouteSysEx : _RouteNone};
+                case MidiProtocol::MessageCategory::RealTime:
+                    return {info.Size, _RouteRealTime};
+                default:
+                    return {0, _RouteNone};
+            }
+        }
+
+        struct _StatusRouteTable {
+            _StatusRoute Entries[256];
+
+            constexpr const _StatusRoute& operator[](uint8_t Status) const { return Entries[Status]; }
+        };
+
+        constexpr _StatusRouteTable _BuildStatusRoutes() {
+            _StatusRouteTable table{};
+            for (unsigned int i = 0; i < 256; i++) {
+                table.Entries[i] = _ClassifyRoute(static_cast<uint8_t>(i));
+            }
+            return table;
+        }
+
+        constexpr _StatusRouteTable _StatusRoutes = _BuildStatusRoutes(); ///< Size and route of every byte value, built at compile time.
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Universal SysEx Routing Table
+
+        // Callback chain of a SysEx message, after the plain SysEx route. Plain `uint8_t` constants,
+        // since they are stored in and compared against `uint8_t` table entries.
+        constexpr uint8_t _UniversalNone  = 0;   ///< Manufacturer SysEx, or Universal SysEx for another device.
+        constexpr uint8_t _UniversalOther = 1;   ///< Universal SysEx, then SysEx.
+        constexpr uint8_t _UniversalMTC   = 2;   ///< MIDI Time Code, then Universal SysEx, then SysEx.
+        constexpr uint8_t _UniversalMSC   = 3;   ///< MIDI Show Control, then Universal SysEx, then SysEx.
+        constexpr uint8_t _UniversalMMC   = 4;   ///< MIDI Machine Control, then Universal SysEx, then SysEx.
+
+        constexpr uint8_t _ClassifyUniversal(uint8_t ID, uint8_t SubID) {
+            if (ID == MIDI_SYSEX_NRT) {
+                return _UniversalOther;
+            }
+            if (ID != MIDI_SYSEX_RT) {
+                return _UniversalNone;
+            }
+
+            switch (SubID) {
+                case MIDI_SYSEX_REALTIME_MTC:       return _UniversalMTC;
+                case MIDI_SYSEX_RT_MSC:             return _UniversalMSC;
+                case MIDI_SYSEX_RT_MMC_COMMAND:
+                case MIDI_SYSEX_RT_MMC_RESPONSE:    return _UniversalMMC;
+                default:                            return _UniversalOther;
+            }
+        }
+
+        struct _UniversalRouteTable {
+            uint8_t Entries[2][128];   ///< Route by [ID is Real-Time][Sub ID 1].
+
+            constexpr uint8_t Lookup(uint8_t ID, uint8_t SubID) const {
+                return (ID == MIDI_SYSEX_NRT || ID == MIDI_SYSEX_RT) ? Entries[ID == MIDI_SYSEX_RT][SubID & 0x7F] : _UniversalNone;
+            }
+        };
+
+        constexpr _UniversalRouteTable _BuildUniversalRoutes() {
+            _UniversalRouteTable table{};
+            for (unsigned int i = 0; i < 128; i++) {
+                table.Entries[0][i] = _ClassifyUniversal(MIDI_SYSEX_NRT, static_cast<uint8_t>(i));
+                table.Entries[1][i] = _ClassifyUniversal(MIDI_SYSEX_RT, static_cast<uint8_t>(i));
+            }
+            return table;
+        }
+
+        constexpr _UniversalRouteTable _UniversalRoutes = _BuildUniversalRoutes(); ///< Route of every Universal SysEx sub-ID, built at compile time.
+
+        constexpr size_t _UniversalHeaderSize = 5; ///< 0xF0, ID, device ID, sub-ID 1 and 0xF7.
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
     // **Constructor**
         MessageParser::MessageParser()
             : MessageParser(3)
@@ -9,11 +128,20 @@ namespace MIDILAR::MidiCore {
         }
 
         MessageParser::MessageParser(size_t BufferSize)
-            : _Status(Status::Idle),
+            : _Batch(nullptr),
+              _SysExStarted(false),
+              _Status(Status::Idle),
+              _MessageSize(0),
               _MessageBuffer(nullptr),
               _MessageBufferSize(0),
-              _MessageSize(0)
+              _Expected(0),
+              _RunningStatus(0),
+              _RunningStatusEnabled(false),
+              _DeviceID(MIDI_SYSEX_ALL_CALL),
+              _MessageTime(0),
+              _DispatchTime(0)
         {
+            MIDILAR_PARSER_COUNT(_SysExStreamSize = 0;)
         	ResizeBuffer(BufferSize);
         }
 
@@ -56,11 +184,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindChannelVoiceCallback( CallbackType callback ){
+            _channelVoiceViewCallback.unbind();
             _channelVoiceCallback.bind(callback);
         }
 
+        void MessageParser::BindChannelVoiceCallback( ViewCallbackType callback ){
+            _channelVoiceCallback.unbind();
+            _channelVoiceViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindChannelVoiceCallback() {
             _channelVoiceCallback.unbind();
+            _channelVoiceViewCallback.unbind();
         }
 
         bool MessageParser::InvokeChannelVoiceCallback(const uint8_t* data, size_t size) {
@@ -68,6 +203,10 @@ namespace MIDILAR::MidiCore {
                 _channelVoiceCallback.invoke(data, size);
                 return true;
             }
+            if (_channelVoiceViewCallback.status()) {
+                _channelVoiceViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -75,11 +214,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindControlChangeCallback( CallbackType callback ){
+            _controlChangeViewCallback.unbind();
             _controlChangeCallback.bind(callback);
         }
 
+        void MessageParser::BindControlChangeCallback( ViewCallbackType callback ){
+            _controlChangeCallback.unbind();
+            _controlChangeViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindControlChangeCallback() {
             _controlChangeCallback.unbind();
+            _controlChangeViewCallback.unbind();
         }
 
         bool MessageParser::InvokeControlChangeCallback(const uint8_t* data, size_t size) {
@@ -87,6 +233,10 @@ namespace MIDILAR::MidiCore {
                 _controlChangeCallback.invoke(data, size);
                 return true;
             }
+            if (_controlChangeViewCallback.status()) {
+                _controlChangeViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -94,11 +244,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindRealTimeCallback( CallbackType callback ){
+            _realTimeViewCallback.unbind();
             _realTimeCallback.bind(callback);
         }
 
+        void MessageParser::BindRealTimeCallback( ViewCallbackType callback ){
+            _realTimeCallback.unbind();
+            _realTimeViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindRealTimeCallback() {
             _realTimeCallback.unbind();
+            _realTimeViewCallback.unbind();
         }
 
         bool MessageParser::InvokeRealTimeCallback(const uint8_t* data, size_t size) {
@@ -106,6 +263,10 @@ namespace MIDILAR::MidiCore {
                 _realTimeCallback.invoke(data, size);
                 return true;
             }
+            if (_realTimeViewCallback.status()) {
+                _realTimeViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -113,11 +274,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindSystemCommonCallback( CallbackType callback ){
+            _systemCommonViewCallback.unbind();
             _systemCommonCallback.bind(callback);
         }
 
+        void MessageParser::BindSystemCommonCallback( ViewCallbackType callback ){
+            _systemCommonCallback.unbind();
+            _systemCommonViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindSystemCommonCallback() {
             _systemCommonCallback.unbind();
+            _systemCommonViewCallback.unbind();
         }
 
         bool MessageParser::InvokeSystemCommonCallback(const uint8_t* data, size_t size) {
@@ -125,6 +293,10 @@ namespace MIDILAR::MidiCore {
                 _systemCommonCallback.invoke(data, size);
                 return true;
             }
+            if (_systemCommonViewCallback.status()) {
+                _systemCommonViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -132,11 +304,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindSysExCallback( CallbackType callback ){
+            _sysExViewCallback.unbind();
             _sysExCallback.bind(callback);
         }
 
+        void MessageParser::BindSysExCallback( ViewCallbackType callback ){
+            _sysExCallback.unbind();
+            _sysExViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindSysExCallback() {
             _sysExCallback.unbind();
+            _sysExViewCallback.unbind();
         }
 
         bool MessageParser::InvokeSysExCallback(const uint8_t* data, size_t size) {
@@ -144,6 +323,10 @@ namespace MIDILAR::MidiCore {
                 _sysExCallback.invoke(data, size);
                 return true;
             }
+            if (_sysExViewCallback.status()) {
+                _sysExViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -151,11 +334,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindMTCCallback( CallbackType callback ){
+            _mtcViewCallback.unbind();
             _mtcCallback.bind(callback);
         }
 
+        void MessageParser::BindMTCCallback( ViewCallbackType callback ){
+            _mtcCallback.unbind();
+            _mtcViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindMTCCallback() {
             _mtcCallback.unbind();
+            _mtcViewCallback.unbind();
         }
 
         bool MessageParser::InvokeMTCCallback(const uint8_t* data, size_t size) {
@@ -163,6 +353,10 @@ namespace MIDILAR::MidiCore {
                 _mtcCallback.invoke(data, size);
                 return true;
             }
+            if (_mtcViewCallback.status()) {
+                _mtcViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -170,11 +364,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindMSCCallback( CallbackType callback ){
+            _mscViewCallback.unbind();
             _mscCallback.bind(callback);
         }
 
+        void MessageParser::BindMSCCallback( ViewCallbackType callback ){
+            _mscCallback.unbind();
+            _mscViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindMSCCallback() {
             _mscCallback.unbind();
+            _mscViewCallback.unbind();
         }
 
         bool MessageParser::InvokeMSCCallback(const uint8_t* data, size_t size) {
@@ -182,6 +383,70 @@ namespace MIDILAR::MidiCore {
                 _mscCallback.invoke(data, size);
                 return true;
             }
+            if (_mscViewCallback.status()) {
+                _mscViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
+            return false;
+        }
+
+
+
+    // **Set Callback Handlers**
+        void MessageParser::BindMMCCallback( CallbackType callback ){
+            _mmcViewCallback.unbind();
+            _mmcCallback.bind(callback);
+        }
+
+        void MessageParser::BindMMCCallback( ViewCallbackType callback ){
+            _mmcCallback.unbind();
+            _mmcViewCallback.bind(callback);
+        }
+
+        void MessageParser::UnbindMMCCallback() {
+            _mmcCallback.unbind();
+            _mmcViewCallback.unbind();
+        }
+
+        bool MessageParser::InvokeMMCCallback(const uint8_t* data, size_t size) {
+            if (_mmcCallback.status()) {
+                _mmcCallback.invoke(data, size);
+                return true;
+            }
+            if (_mmcViewCallback.status()) {
+                _mmcViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
+            return false;
+        }
+
+
+
+    // **Set Callback Handlers**
+        void MessageParser::BindUniversalSysExCallback( CallbackType callback ){
+            _universalSysExViewCallback.unbind();
+            _universalSysExCallback.bind(callback);
+        }
+
+        void MessageParser::BindUniversalSysExCallback( ViewCallbackType callback ){
+            _universalSysExCallback.unbind();
+            _universalSysExViewCallback.bind(callback);
+        }
+
+        void MessageParser::UnbindUniversalSysExCallback() {
+            _universalSysExCallback.unbind();
+            _universalSysExViewCallback.unbind();
+        }
+
+        bool MessageParser::InvokeUniversalSysExCallback(const uint8_t* data, size_t size) {
+            if (_universalSysExCallback.status()) {
+                _universalSysExCallback.invoke(data, size);
+                return true;
+            }
+            if (_universalSysExViewCallback.status()) {
+                _universalSysExViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -189,11 +454,18 @@ namespace MIDILAR::MidiCore {
 
     // **Set Callback Handlers**
         void MessageParser::BindDefaultCallback( CallbackType callback ){
+            _defaultViewCallback.unbind();
             _defaultCallback.bind(callback);
         }
 
+        void MessageParser::BindDefaultCallback( ViewCallbackType callback ){
+            _defaultCallback.unbind();
+            _defaultViewCallback.bind(callback);
+        }
+
         void MessageParser::UnbindDefaultCallback() {
-            _defaultCallback.unbind(); 
+            _defaultCallback.unbind();
+            _defaultViewCallback.unbind();
         }
 
         bool MessageParser::InvokeDefaultCallback(const uint8_t* data, size_t size) {
@@ -201,6 +473,10 @@ namespace MIDILAR::MidiCore {
                 _defaultCallback.invoke(data, size);
                 return true;
             }
+            if (_defaultViewCallback.status()) {
+                _defaultViewCallback.invoke(MessageView(data, size));
+                return true;
+            }
             return false;
         }
 
@@ -214,200 +490,392 @@ namespace MIDILAR::MidiCore {
             _sysExCallback.unbind();
             _mtcCallback.unbind();
             _mscCallback.unbind();
+            _mmcCallback.unbind();
+            _universalSysExCallback.unbind();
             _defaultCallback.unbind();
+
+            _channelVoiceViewCallback.unbind();
+            _controlChangeViewCallback.unbind();
+            _realTimeViewCallback.unbind();
+            _systemCommonViewCallback.unbind();
+            _sysExViewCallback.unbind();
+            _mtcViewCallback.unbind();
+            _mscViewCallback.unbind();
+            _mmcViewCallback.unbind();
+            _universalSysExViewCallback.unbind();
+            _defaultViewCallback.unbind();
+
+            UnbindBatchCallback();
+            UnbindSysExStreamCallback();
         }
 
-    // **Process Incoming MIDI Data**
-        void MessageParser::ProcessData(const uint8_t* data, size_t size) {
-            if (size == 0) return;
+    // **Streamed SysEx**
+        void MessageParser::BindSysExStreamCallback(SysExStreamCallbackType callback) {
+            _sysExStreamCallback.bind(callback);
+        }
 
-            for (size_t i = 0; i < size; i++) {
-                _StatusByteHandler(data[i]);
+        void MessageParser::UnbindSysExStreamCallback() {
+            _sysExStreamCallback.unbind();
+            _SysExStarted = false;
+            MIDILAR_PARSER_COUNT(_SysExStreamSize = 0;)
+        }
 
-                // Append New Data To Buffer
-                if (_Status == Status::Processing || _Status == Status::ProcessingSysex) {
-                    if (_MessageSize < _MessageBufferSize) {
-                        _MessageBuffer[_MessageSize++] = data[i];
-                    } else {
-                        // Buffer Overflow
-                        _Status = Status::Idle;
-                        _MessageSize = 0;
-                    }
-                }
+        void MessageParser::_SysExStreamChunk(const uint8_t* data, size_t size, bool last) {
+            if (size == 0 && !last) {
+                return;
+            }
 
-                // Check Message
-                if (_Status == Status::Processing) {
-                    _RealTimeHandler();
-                    _ChannelVoiceHandler();
-                    _SystemCommonHandler();
+            SysExChunk chunk = _SysExStarted ? (last ? SysExChunk::End : SysExChunk::Continue)
+                                             : (last ? SysExChunk::Complete : SysExChunk::Start);
+            _SysExStarted = !last;
+            if (_Batch != nullptr) {
+                _FlushBatch(); // Messages completed before the chunk reach the consumer first
+            }
+            _DispatchTime = _MessageTime;
+            _sysExStreamCallback.invoke(data, size, chunk);
+
+            #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+                _SysExStreamSize += size;
+                if (last) {
+                    _Messages[static_cast<size_t>(MidiProtocol::MessageCategory::SystemExclusive)].Add(1);
+                    _MaxSysExSize.Max(_SysExStreamSize);
+                    _SysExStreamSize = 0;
                 }
+            #endif
+        }
 
-                // SysEx Message Handling
-                if (_Status == Status::ProcessingSysex) {
-                    _SysExHandler();
+        void MessageParser::_SysExStreamAbort() {
+            if (_SysExStarted && _sysExStreamCallback.status()) {
+                if (_Batch != nullptr) {
+                    _FlushBatch();
                 }
+                _sysExStreamCallback.invoke(nullptr, 0, SysExChunk::Abort);
             }
+            _SysExStarted = false;
+            MIDILAR_PARSER_COUNT(_SysExStreamSize = 0;)
         }
 
-    // **Status Byte Handling**
-        void MessageParser::_StatusByteHandler(uint8_t data) {
-            if (data & 0x80) { // **Status Byte Detected**
-                if (_Status == Status::ProcessingSysex) {
-                    if(data != MIDI_SYSEX_END){
-                        // **Unexpected Status Byte Inside SysEx → Discard Message**
-                        _Status = Status::Idle;
-                        _MessageSize = 0;
-                    }
-                    
-                    return;
-                }
+    // **Batched Dispatch**
+        void MessageParser::BindBatchCallback(BatchCallbackType callback, Batch& Storage) {
+            _batchCallback.bind(callback);
+            _Batch = &Storage;
+            _Batch->Clear();
+        }
 
-                if (data == MIDI_SYSEX_START) { 
-                    _Status = Status::ProcessingSysex;
-                    _MessageSize = 0;
-                } else {
-                    _Status = Status::Processing;
-                    _MessageSize = 0;
-                }
+        void MessageParser::UnbindBatchCallback() {
+            _batchCallback.unbind();
+            _Batch = nullptr;
+        }
+
+        bool MessageParser::_BatchAppend(const uint8_t* data, size_t size) {
+            Batch& batch = *_Batch;
+            if (size > batch._DataCapacity || size > UINT16_MAX || batch._EntryCapacity == 0) {
+                _FlushBatch(); // Keep the arrival order
+                return false;
             }
+
+            if (batch._Count == batch._EntryCapacity || size > batch._DataCapacity - batch._DataSize) {
+                _FlushBatch();
+            }
+
+            memcpy(batch._Data + batch._DataSize, data, size);
+            batch._Entries[batch._Count++] = {static_cast<uint32_t>(batch._DataSize), static_cast<uint16_t>(size),
+                                              MidiProtocol::StatusTable[data[0]].Category, _DispatchTime};
+            batch._DataSize += size;
+            return true;
         }
 
-    // **Real-Time Message Handling**
-        void MessageParser::_RealTimeHandler() {
-            if (_MessageSize == 1) {
-                switch (_MessageBuffer[0]) {
-                    case MIDI_REALTIME_TIMING_TICK:
-                    case MIDI_REALTIME_START:
-                    case MIDI_REALTIME_CONTINUE:
-                    case MIDI_REALTIME_STOP:
-                    case MIDI_REALTIME_ACTIVE_SENSING:
-                    case MIDI_REALTIME_SYSTEM_RESET:
-                        if (!InvokeRealTimeCallback(_MessageBuffer, _MessageSize)) {
-                            InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                        } 
-                        _Status = Status::Idle;
-                        _MessageSize = 0;
-                        break;
-                }
+        void MessageParser::_FlushBatch() {
+            if (_Batch->_Count > 0) {
+                _batchCallback.invoke(*_Batch);
+                _Batch->Clear();
             }
         }
 
-    // **Channel Voice & Control Change Messages**
-        void MessageParser::_ChannelVoiceHandler() {
-        if (_MessageSize == 2) {
-            switch (_MessageBuffer[0] & 0xF0) {
-                case MIDI_CHANNEL_PRESSURE:
-                case MIDI_PROGRAM_CHANGE:
-                    if (!InvokeChannelVoiceCallback(_MessageBuffer, _MessageSize)) {
-                        InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                    }
-                    _Status = Status::Idle;
-                    _MessageSize = 0;
-                    break;
+    // **Running Status**
+        void MessageParser::SetRunningStatus(bool Enabled) {
+            _RunningStatusEnabled = Enabled;
+            _RunningStatus = 0;
+        }
 
-                default:
-                    break;
-            }
+        bool MessageParser::RunningStatusEnabled() const {
+            return _RunningStatusEnabled;
         }
 
-        if (_MessageSize == 3) { 
-            switch (_MessageBuffer[0] & 0xF0) {
-                case MIDI_CONTROL_CHANGE:
-                    if (!InvokeControlChangeCallback(_MessageBuffer, _MessageSize)) {
-                        if (!InvokeChannelVoiceCallback(_MessageBuffer, _MessageSize)) {
-                            InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                        }
-                    }
-                    _Status = Status::Idle;
-                    _MessageSize = 0;
-                    break;
+        void MessageParser::SetDeviceID(uint8_t ID) {
+            _DeviceID = ID & 0x7F;
+        }
 
-                case MIDI_NOTE_OFF:
-                case MIDI_NOTE_ON:
-                case MIDI_AFTER_TOUCH:
-                case MIDI_PITCH_BEND:
-                    if (!InvokeChannelVoiceCallback(_MessageBuffer, _MessageSize)) {
-                        InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                    }
-                    _Status = Status::Idle;
-                    _MessageSize = 0;
-                    break;
+        uint8_t MessageParser::DeviceID() const {
+            return _DeviceID;
+        }
 
-                default:
-                    break;
+        void MessageParser::Reset() {
+            if (_Status == Status::ProcessingSysex) {
+                MIDILAR_PARSER_COUNT(_SysExAborts.Add(1);)
+                _SysExStreamAbort();
             }
+            _Status = Status::Idle;
+            _MessageSize = 0;
+            _RunningStatus = 0;
         }
-    }
 
+    // **Process Incoming MIDI Data**
+        void MessageParser::ProcessData(const uint8_t* data, size_t size) {
+            _ProcessData(data, size, 0, 0, nullptr);
+        }
+
+        void MessageParser::ProcessData(const uint8_t* data, size_t size, SystemCore::Clock::TimePoint Time, SystemCore::Clock::TimePoint BytePeriod) {
+            _ProcessData(data, size, Time, BytePeriod, nullptr);
+        }
+
+        void MessageParser::ProcessData(const uint8_t* data, size_t size, const SystemCore::Clock::TimePoint* Times) {
+            _ProcessData(data, size, 0, 0, Times); // Untimed, as the plain overload, when Times is nullptr
+        }
 
-    // **System Common Messages**
-        void MessageParser::_SystemCommonHandler() {
-            if (_MessageSize == 1) {
-                switch (_MessageBuffer[0]) {
-                    case MIDI_TUNING_REQUEST:
-                        if (!InvokeSystemCommonCallback(_MessageBuffer, _MessageSize)) {
-                            InvokeDefaultCallback(_MessageBuffer, _MessageSize);
+        SystemCore::Clock::TimePoint MessageParser::MessageTime() const {
+            return _DispatchTime;
+        }
+
+        void MessageParser::_ProcessData(const uint8_t* data, size_t size, SystemCore::Clock::TimePoint Time,
+                                         SystemCore::Clock::TimePoint BytePeriod, const SystemCore::Clock::TimePoint* Times) {
+            // Arrival time of a byte, only computed where a message or a Real-Time byte starts
+            auto time_of = [=](size_t i) -> SystemCore::Clock::TimePoint {
+                return Times ? Times[i] : static_cast<SystemCore::Clock::TimePoint>(Time + i * BytePeriod);
+            };
+
+            MIDILAR_PARSER_COUNT(_BytesProcessed.Add(size);)
+
+            for (size_t i = 0; i < size; i++) {
+                uint8_t byte = data[i];
+
+                // Data byte: append it and dispatch once the message reaches the size set by its status byte
+                if (byte < 0x80) {
+                    if (_Status == Status::ProcessingSysex) {
+                        // Copy the whole run of SysEx data bytes at once, up to the next status byte
+                        size_t run = MidiProtocol::Scan::DataRunLength(data + i, size - i);
+                        if (run > _MessageBufferSize - _MessageSize && _sysExStreamCallback.status()) {
+                            // Streaming: pass what is buffered, then the run straight from the input
+                            _SysExStreamChunk(_MessageBuffer, _MessageSize, false);
+                            _SysExStreamChunk(data + i, run, false);
+                            _MessageSize = 0;
+                        } else if (run > _MessageBufferSize - _MessageSize) {
+                            // Buffer Overflow
+                            MIDILAR_PARSER_COUNT(_BufferOverflows.Add(1);)
+                            _Status = Status::Idle;
+                            _MessageSize = 0;
+                        } else {
+                            memcpy(_MessageBuffer + _MessageSize, data + i, run);
+                            _MessageSize += run;
                         }
-                        _Status = Status::Idle;
-                        _MessageSize = 0;
-                        break;
-                }
-            } 
-            else if (_MessageSize == 2) {
-                switch (_MessageBuffer[0]) {
-                    case MIDI_MTC_QUARTER_FRAME:
-
-                        if (!InvokeMTCCallback(_MessageBuffer, _MessageSize)) { 
-                            if (!InvokeSystemCommonCallback(_MessageBuffer, _MessageSize)) {
-                                InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                            }
+                        i += run - 1;
+                        continue;
+                    }
+
+                    if (_Status == Status::Idle) {
+                        if (_RunningStatus == 0 || _MessageBufferSize == 0) {
+                            size_t run = MidiProtocol::Scan::DataRunLength(data + i, size - i);
+                            MIDILAR_PARSER_COUNT(_StrayDataBytes.Add(run);)
+                            i += run - 1;
+                            continue; // No status in effect, drop the bytes up to the next status byte
                         }
+                        // Running status: restart the message from the status byte in effect
+                        _MessageBuffer[0] = _RunningStatus;
+                        _MessageSize = 1;
+                        _MessageTime = time_of(i);
+                        _Expected = _StatusRoutes[_RunningStatus].Size;
+                        _Status = Status::Processing;
+                    }
 
+                    if (_MessageSize >= _MessageBufferSize) {
+                        // Buffer Overflow
+                        MIDILAR_PARSER_COUNT(_BufferOverflows.Add(1);)
                         _Status = Status::Idle;
                         _MessageSize = 0;
-                        break;
-
-                    case MIDI_SONG_SELECT:
-                        
-                        if (!InvokeSystemCommonCallback(_MessageBuffer, _MessageSize)) {
-                            InvokeDefaultCallback(_MessageBuffer, _MessageSize);
-                        }
+                        continue;
+                    }
 
+                    _MessageBuffer[_MessageSize++] = byte;
+                    if (_MessageSize == _Expected) { // Never true for SysEx, whose expected size is 0
+                        _Dispatch(_StatusRoutes[_MessageBuffer[0]].Route, _MessageBuffer, _MessageSize, _MessageTime);
                         _Status = Status::Idle;
                         _MessageSize = 0;
-                        break;
+                    }
+                    continue;
+                }
+
+                const _StatusRoute& route = _StatusRoutes[byte];
 
-                    default: break;
+                // Real-Time bytes may appear anywhere, even inside another message: dispatch them without touching its state
+                if (byte >= MIDI_REALTIME_TIMING_TICK) {
+                    if (route.Route == _RouteRealTime) {
+                        _Dispatch(_RouteRealTime, &data[i], 1, time_of(i));
+                    }
+                    continue; // Undefined Real-Time bytes (0xF9, 0xFD) are ignored
                 }
-            }
-            else if (_MessageSize == 3) {
-                switch (_MessageBuffer[0]) {
-                    case MIDI_SONG_POSITION_POINTER:
 
-                        if (!InvokeSystemCommonCallback(_MessageBuffer, _MessageSize)) {
-                            InvokeDefaultCallback(_MessageBuffer, _MessageSize);
+                // End of SysEx
+                if (byte == MIDI_SYSEX_END && _Status == Status::ProcessingSysex) {
+                    if (_sysExStreamCallback.status()) {
+                        if (_MessageSize < _MessageBufferSize) {
+                            _MessageBuffer[_MessageSize++] = byte;
+                            _SysExStreamChunk(_MessageBuffer, _MessageSize, true);
+                        } else {
+                            _SysExStreamChunk(_MessageBuffer, _MessageSize, false);
+                            _SysExStreamChunk(&data[i], 1, true);
                         }
+                    } else if (_MessageSize < _MessageBufferSize) {
+                        _MessageBuffer[_MessageSize++] = byte;
+                        _Dispatch(_RouteSysEx, _MessageBuffer, _MessageSize, _MessageTime);
+                    } else {
+                        MIDILAR_PARSER_COUNT(_BufferOverflows.Add(1);) // No room left for 0xF7
+                    }
+                    _Status = Status::Idle;
+                    _MessageSize = 0;
+                    continue;
+                }
 
-                        _Status = Status::Idle;
-                        _MessageSize = 0;
-                        break;
+                // Any other status byte ends the message in progress and starts a new one.
+                // Channel Voice sets the running status, System Common and SysEx clear it.
+                if (_Status == Status::ProcessingSysex) {
+                    MIDILAR_PARSER_COUNT(_SysExAborts.Add(1);)
+                    _SysExStreamAbort();
+                }
+                _RunningStatus = (_RunningStatusEnabled && byte < MIDI_SYSEX_START) ? byte : 0;
+                _Status = Status::Idle;
+                _MessageSize = 0;
+                _MessageTime = time_of(i);
+
+                if (route.Route == _RouteNone || _MessageBufferSize == 0) {
+                    continue; // Undefined status bytes (0xF4, 0xF5) and 0xF7 outside a SysEx
+                }
+
+                // Fast path: the complete message is in the input, dispatch it in place without staging it
+                if (route.Size > 1 && route.Size <= size - i && route.Size <= _MessageBufferSize &&
+                    data[i + 1] < 0x80 && (route.Size == 2 || data[i + 2] < 0x80)) {
+                    _Dispatch(route.Route, data + i, route.Size, _MessageTime);
+                    i += route.Size - 1;
+                    continue;
+                }
 
-                    default: break;
+                _MessageBuffer[0] = byte;
+                _MessageSize = 1;
+                _Expected = route.Size;
+                _Status = (route.Route == _RouteSysEx) ? Status::ProcessingSysex : Status::Processing;
+
+                if (_Expected == 1) { // Tuning Request
+                    _Dispatch(route.Route, _MessageBuffer, _MessageSize, _MessageTime);
+                    _Status = Status::Idle;
+                    _MessageSize = 0;
                 }
             }
+
+            // Streaming: hand over the SysEx bytes received so far instead of waiting for the buffer to fill
+            if (_Status == Status::ProcessingSysex && _MessageSize > 0 && _sysExStreamCallback.status()) {
+                _SysExStreamChunk(_MessageBuffer, _MessageSize, false);
+                _MessageSize = 0;
+            }
+
+            if (_Batch != nullptr) {
+                _FlushBatch();
+            }
+        }
+
+    #if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+        void MessageParser::ProcessData(const MessageBatch& batch) {
+            ProcessData(batch.Buffer(), batch.ByteSize());
         }
+    #endif
 
-    // **SysEx Message Handling**
-        void MessageParser::_SysExHandler() {
-            if (_MessageSize > 0 && _MessageBuffer[_MessageSize - 1] == MIDI_SYSEX_END) { // SysEx message complete
+    // **Message Dispatch**
+        void MessageParser::_Dispatch(uint8_t Route, const uint8_t* data, size_t size, SystemCore::Clock::TimePoint Time) {
+            _DispatchTime = Time;
 
-                if (!InvokeSysExCallback(_MessageBuffer, _MessageSize)) {
-                    InvokeDefaultCallback(_MessageBuffer, _MessageSize);
+            #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+                _Messages[static_cast<size_t>(MidiProtocol::StatusTable[data[0]].Category)].Add(1);
+                if (Route == _RouteSysEx) {
+                    _MaxSysExSize.Max(size);
                 }
+            #endif
 
-                _Status = Status::Idle;
-                _MessageSize = 0;
+            if (_Batch != nullptr && _BatchAppend(data, size)) {
+                return;
+            }
+
+            // A route whose callback is not bound falls through to the broader one below it, then to the default callback
+            switch (Route) {
+                case _RouteControlChange:
+                    if (InvokeControlChangeCallback(data, size)) return;
+                    [[fallthrough]];
+                case _RouteChannelVoice:
+                    if (InvokeChannelVoiceCallback(data, size)) return;
+                    break;
+
+                case _RouteMTC:
+                    if (InvokeMTCCallback(data, size)) return;
+                    [[fallthrough]];
+                case _RouteSystemCommon:
+                    if (InvokeSystemCommonCallback(data, size)) return;
+                    break;
+
+                case _RouteSysEx: {
+                    // Universal SysEx addressed to this device: one lookup on the ID and sub-ID picks the chain
+                    uint8_t universal = (size >= _UniversalHeaderSize) ? _UniversalRoutes.Lookup(data[1], data[3]) : _UniversalNone;
+                    if (universal != _UniversalNone && _DeviceID != MIDI_SYSEX_ALL_CALL &&
+                        data[2] != MIDI_SYSEX_ALL_CALL && data[2] != _DeviceID) {
+                        universal = _UniversalNone;
+                    }
+
+                    switch (universal) {
+                        case _UniversalMTC: if (InvokeMTCCallback(data, size)) return; break;
+                        case _UniversalMSC: if (InvokeMSCCallback(data, size)) return; break;
+                        case _UniversalMMC: if (InvokeMMCCallback(data, size)) return; break;
+                        default: break;
+                    }
+                    if (universal != _UniversalNone && InvokeUniversalSysExCallback(data, size)) return;
+                    if (InvokeSysExCallback(data, size)) return;
+                    break;
+                }
+
+                case _RouteRealTime:
+                    if (InvokeRealTimeCallback(data, size)) return;
+                    break;
+
+                default: break;
+            }
+
+            MIDILAR_PARSER_COUNT(_DefaultFallthroughs.Add(1);)
+            InvokeDefaultCallback(data, size);
+        }
+
+    #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+    // **Statistics**
+        MessageParser::Statistics MessageParser::GetStatistics() const {
+            Statistics stats;
+            stats.BytesProcessed = _BytesProcessed.Get();
+            stats.ChannelVoiceMessages = _Messages[static_cast<size_t>(MidiProtocol::MessageCategory::ChannelVoice)].Get();
+            stats.SystemCommonMessages = _Messages[static_cast<size_t>(MidiProtocol::MessageCategory::SystemCommon)].Get();
+            stats.SysExMessages = _Messages[static_cast<size_t>(MidiProtocol::MessageCategory::SystemExclusive)].Get();
+            stats.RealTimeMessages = _Messages[static_cast<size_t>(MidiProtocol::MessageCategory::RealTime)].Get();
+            stats.StrayDataBytes = _StrayDataBytes.Get();
+            stats.SysExAborts = _SysExAborts.Get();
+            stats.BufferOverflows = _BufferOverflows.Get();
+            stats.MaxSysExSize = _MaxSysExSize.Get();
+            stats.DefaultFallthroughs = _DefaultFallthroughs.Get();
+            return stats;
+        }
+
+        void MessageParser::ResetStatistics() {
+            _BytesProcessed.Set(0);
+            for (_Counter& counter : _Messages) {
+                counter.Set(0);
             }
+            _StrayDataBytes.Set(0);
+            _SysExAborts.Set(0);
+            _BufferOverflows.Set(0);
+            _MaxSysExSize.Set(0);
+            _DefaultFallthroughs.Set(0);
         }
+    #endif
 
 }
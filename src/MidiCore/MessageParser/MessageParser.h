@@ -3,9 +3,19 @@
 
 #include <MIDILAR_BuildSettings.h>
 #include <SystemCore/CallbackHandler/CallbackHandler.h>
+#include <SystemCore/Clock/Clock.h>
 #include <MidiCore/Message/Message.h>
+#include <MidiCore/Message/MessageView.h>
 #include <stdlib.h>
 
+#if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+    #include <MidiCore/MessageBatch/MessageBatch.h>
+#endif
+
+#if defined(MIDILAR_MESSAGE_PARSER_STATISTICS) && __has_include(<atomic>)
+    #include <atomic>
+#endif
+
 namespace MIDILAR::MidiCore {
 
     /**
@@ -34,9 +44,134 @@ namespace MIDILAR::MidiCore {
          */
         using CallbackType = MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t>::CallbackType;
 
+        /**
+         * @brief Callback type for handlers that receive a typed `MessageView`.
+         *
+         * The view points into the parser buffer and is only valid during the callback.
+         */
+        using ViewCallbackType = MIDILAR::SystemCore::CallbackHandler<void, const MessageView&>::CallbackType;
+
+        /**
+         * @brief Location and category of one message in a `Batch`.
+         */
+        struct BatchEntry {
+            uint32_t Offset;                            /**< Offset of the first byte in the batch data. */
+            uint16_t Size;                              /**< Size of the message in bytes. */
+            MidiProtocol::MessageCategory Category;     /**< Category of the message status byte. */
+            MIDILAR::SystemCore::Clock::TimePoint Time; /**< Arrival time of the message, see `MessageTime()`. */
+        };
+
+        /**
+         * @class Batch
+         * @brief Collects the messages parsed from one input chunk, in arrival order.
+         *
+         * The batch works on storage supplied by the caller and never allocates: message bytes are
+         * copied back to back in a data buffer, and an entry array records where each message starts.
+         * The batch is passed to the batch callback and cleared once the callback returns.
+         */
+        class Batch {
+            friend class MessageParser;
+
+        private:
+            BatchEntry* _Entries;       /**< Caller storage for the message entries. */
+            size_t _EntryCapacity;      /**< Number of entries `_Entries` can hold. */
+            size_t _Count;              /**< Number of messages in the batch. */
+            uint8_t* _Data;             /**< Caller storage for the message bytes. */
+            size_t _DataCapacity;       /**< Size of `_Data` in bytes. */
+            size_t _DataSize;           /**< Number of bytes in use in `_Data`. */
+
+        public:
+            /**
+             * @brief Constructs a batch over caller storage.
+             * @param Entries Array receiving one entry per message.
+             * @param EntryCapacity Number of elements in `Entries`.
+             * @param Data Buffer receiving the message bytes.
+             * @param DataCapacity Size of `Data` in bytes.
+             */
+            Batch(BatchEntry* Entries, size_t EntryCapacity, uint8_t* Data, size_t DataCapacity) noexcept
+                : _Entries(Entries), _EntryCapacity(Entries ? EntryCapacity : 0), _Count(0),
+                  _Data(Data), _DataCapacity(Data ? DataCapacity : 0), _DataSize(0) {}
+
+            Batch(const Batch&) = delete;
+            Batch& operator=(const Batch&) = delete;
+
+            size_t size() const noexcept { return _Count; }                         /**< Returns the number of messages. */
+            bool empty() const noexcept { return _Count == 0; }                     /**< Returns true if the batch holds no message. */
+            const BatchEntry& Entry(size_t Index) const { return _Entries[Index]; } /**< Returns the entry of a message. */
+            const uint8_t* Buffer() const noexcept { return _Data; }                /**< Returns the message bytes, stored back to back. */
+            size_t ByteSize() const noexcept { return _DataSize; }                  /**< Returns the number of message bytes. */
+
+            /**
+             * @brief Returns a view of a message. `Index` must be less than `size()`.
+             */
+            MessageView operator[](size_t Index) const {
+                return MessageView(_Data + _Entries[Index].Offset, _Entries[Index].Size);
+            }
+
+            void Clear() noexcept { _Count = 0; _DataSize = 0; } /**< Removes every message. */
+        };
+
+        /**
+         * @class StaticBatch
+         * @brief `Batch` owning fixed-size storage.
+         * @tparam Messages Maximum number of messages.
+         * @tparam Bytes Size of the message data buffer.
+         */
+        template <size_t Messages, size_t Bytes>
+        class StaticBatch : public Batch {
+        private:
+            BatchEntry _EntryStorage[Messages];
+            uint8_t _DataStorage[Bytes];
+
+        public:
+            StaticBatch() noexcept : Batch(_EntryStorage, Messages, _DataStorage, Bytes) {}
+        };
+
+        /**
+         * @brief Callback type for the batch callback.
+         */
+        using BatchCallbackType = MIDILAR::SystemCore::CallbackHandler<void, const Batch&>::CallbackType;
+
+        /**
+         * @brief Position of a chunk within a streamed SysEx message.
+         */
+        enum class SysExChunk : uint8_t {
+            Start,      /**< First chunk, starting with 0xF0. */
+            Continue,   /**< Intermediate chunk of data bytes. */
+            End,        /**< Last chunk, ending with 0xF7. */
+            Complete,   /**< Whole message in a single chunk, from 0xF0 to 0xF7. */
+            Abort       /**< The message was interrupted by a status byte; the chunk is empty. */
+        };
+
+        /**
+         * @brief Callback type for streamed SysEx chunks.
+         *
+         * The callback receives a pointer to the chunk bytes, the chunk size and its position in the message.
+         */
+        using SysExStreamCallbackType = MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t, SysExChunk>::CallbackType;
+
+        #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+            /**
+             * @brief Snapshot of the parser counters, see `GetStatistics()`.
+             */
+            struct Statistics {
+                size_t BytesProcessed;          /**< Bytes passed to `ProcessData`. */
+                size_t ChannelVoiceMessages;    /**< Complete Channel Voice messages, Control Change included. */
+                size_t SystemCommonMessages;    /**< Complete System Common messages, MIDI Time Code included. */
+                size_t SysExMessages;           /**< Complete SysEx messages, streamed or not. */
+                size_t RealTimeMessages;        /**< Real-Time messages. */
+                size_t StrayDataBytes;          /**< Data bytes discarded because no status byte was in effect. */
+                size_t SysExAborts;             /**< SysEx messages interrupted by a status byte or `Reset()`. */
+                size_t BufferOverflows;         /**< Messages discarded because they did not fit in the buffer. */
+                size_t MaxSysExSize;            /**< Size of the longest complete SysEx message, 0xF0 and 0xF7 included. */
+                size_t DefaultFallthroughs;     /**< Messages that reached the default callback path because no category callback was bound. */
+            };
+        #endif
+
     private:
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _channelVoiceCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _channelVoiceViewCallback;
 
         /**
          * @brief Invokes the Channel Voice callback if one is bound.
@@ -47,6 +182,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeChannelVoiceCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _controlChangeCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _controlChangeViewCallback;
 
         /**
          * @brief Invokes the Control Change callback if one is bound.
@@ -57,6 +193,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeControlChangeCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _realTimeCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _realTimeViewCallback;
 
         /**
          * @brief Invokes the Real-Time callback if one is bound.
@@ -67,6 +204,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeRealTimeCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _systemCommonCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _systemCommonViewCallback;
 
         /**
          * @brief Invokes the System Common callback if one is bound.
@@ -77,6 +215,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeSystemCommonCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _sysExCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _sysExViewCallback;
 
         /**
          * @brief Invokes the System Exclusive callback if one is bound.
@@ -87,6 +226,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeSysExCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _mtcCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _mtcViewCallback;
 
         /**
          * @brief Invokes the MIDI Time Code callback if one is bound.
@@ -97,6 +237,7 @@ namespace MIDILAR::MidiCore {
         bool InvokeMTCCallback(const uint8_t* Data, size_t Size);
 
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _mscCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _mscViewCallback;
 
         /**
          * @brief Invokes the MIDI Show Control callback if one is bound.
@@ -106,7 +247,30 @@ namespace MIDILAR::MidiCore {
          */
         bool InvokeMSCCallback(const uint8_t* Data, size_t Size);
 
+        MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _mmcCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _mmcViewCallback;
+
+        /**
+         * @brief Invokes the MIDI Machine Control callback if one is bound.
+         * @param Data Pointer to the parsed MIDI message.
+         * @param Size Size of the parsed message in bytes.
+         * @return True if a callback was invoked successfully, false otherwise.
+         */
+        bool InvokeMMCCallback(const uint8_t* Data, size_t Size);
+
+        MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _universalSysExCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _universalSysExViewCallback;
+
+        /**
+         * @brief Invokes the Universal SysEx callback if one is bound.
+         * @param Data Pointer to the parsed MIDI message.
+         * @param Size Size of the parsed message in bytes.
+         * @return True if a callback was invoked successfully, false otherwise.
+         */
+        bool InvokeUniversalSysExCallback(const uint8_t* Data, size_t Size);
+
         MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _defaultCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, const MessageView&> _defaultViewCallback;
 
         /**
          * @brief Invokes the default callback if one is bound.
@@ -116,6 +280,36 @@ namespace MIDILAR::MidiCore {
          */
         bool InvokeDefaultCallback(const uint8_t* Data, size_t Size);
 
+        MIDILAR::SystemCore::CallbackHandler<void, const Batch&> _batchCallback;
+        Batch* _Batch;              /**< Batch receiving parsed messages, nullptr when batching is off. */
+
+        /**
+         * @brief Appends a complete message to the batch, flushing it first if it is full.
+         * @return False if the message can never fit in the batch and must be dispatched individually.
+         */
+        bool _BatchAppend(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Passes the batch to the batch callback and clears it.
+         */
+        void _FlushBatch();
+
+        MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t, SysExChunk> _sysExStreamCallback;
+        bool _SysExStarted;         /**< True once the first chunk of the streamed SysEx in progress is delivered. */
+
+        /**
+         * @brief Delivers a chunk of the SysEx in progress to the stream callback.
+         * @param data Pointer to the chunk bytes.
+         * @param size Size of the chunk; empty intermediate chunks are skipped.
+         * @param last True if the chunk ends with 0xF7.
+         */
+        void _SysExStreamChunk(const uint8_t* data, size_t size, bool last);
+
+        /**
+         * @brief Notifies the stream callback that the SysEx in progress was interrupted.
+         */
+        void _SysExStreamAbort();
+
         /**
          * @brief Internal parser state.
          */
@@ -129,6 +323,52 @@ namespace MIDILAR::MidiCore {
         size_t _MessageSize;        /**< Current number of bytes stored in the message buffer. */
         uint8_t* _MessageBuffer;    /**< Internal message accumulation buffer. */
         size_t _MessageBufferSize;  /**< Total capacity of the internal message buffer. */
+        uint8_t _Expected;          /**< Complete size of the message in progress, 0 for SysEx. */
+        uint8_t _RunningStatus;     /**< Channel Voice status byte in effect, 0 when none. */
+        bool _RunningStatusEnabled; /**< True when data bytes without a status byte reuse `_RunningStatus`. */
+        uint8_t _DeviceID;          /**< SysEx device ID Universal messages must address, 0x7F to accept any. */
+        MIDILAR::SystemCore::Clock::TimePoint _MessageTime;     /**< Arrival time of the message in progress. */
+        MIDILAR::SystemCore::Clock::TimePoint _DispatchTime;    /**< Arrival time of the message being dispatched. */
+
+        #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+            /**
+             * @brief Counter written by the parsing thread and read from any thread.
+             *
+             * Only one thread updates the counters, so a relaxed load and store is enough and no
+             * read-modify-write instruction is needed on the parsing path.
+             */
+            class _Counter {
+            private:
+                #if __has_include(<atomic>)
+                    std::atomic<size_t> _Value;
+                #else
+                    volatile size_t _Value;
+                #endif
+
+            public:
+                _Counter() noexcept : _Value(0) {}
+
+                #if __has_include(<atomic>)
+                    size_t Get() const noexcept { return _Value.load(std::memory_order_relaxed); }
+                    void Set(size_t Value) noexcept { _Value.store(Value, std::memory_order_relaxed); }
+                #else
+                    size_t Get() const noexcept { return _Value; }
+                    void Set(size_t Value) noexcept { _Value = Value; }
+                #endif
+
+                void Add(size_t Count) noexcept { Set(Get() + Count); }
+                void Max(size_t Value) noexcept { if (Value > Get()) Set(Value); }
+            };
+
+            _Counter _BytesProcessed;
+            _Counter _Messages[5];          /**< Complete messages, indexed by `MidiProtocol::MessageCategory`. */
+            _Counter _StrayDataBytes;
+            _Counter _SysExAborts;
+            _Counter _BufferOverflows;
+            _Counter _MaxSysExSize;
+            _Counter _DefaultFallthroughs;
+            size_t _SysExStreamSize;        /**< Bytes delivered so far for the streamed SysEx in progress. */
+        #endif
 
     public:
 
@@ -169,9 +409,28 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindChannelVoiceCallback(T* instance) {
+            _channelVoiceViewCallback.unbind();
             _channelVoiceCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for Channel Voice messages.
+         * @param callback Callback function to bind.
+         */
+        void BindChannelVoiceCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for Channel Voice messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindChannelVoiceCallback(T* instance) {
+            _channelVoiceCallback.unbind();
+            _channelVoiceViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for Control Change messages.
          * @param callback Callback function to bind.
@@ -186,9 +445,28 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindControlChangeCallback(T* instance) {
+            _controlChangeViewCallback.unbind();
             _controlChangeCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for Control Change messages.
+         * @param callback Callback function to bind.
+         */
+        void BindControlChangeCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for Control Change messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindControlChangeCallback(T* instance) {
+            _controlChangeCallback.unbind();
+            _controlChangeViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for Real-Time messages.
          * @param callback Callback function to bind.
@@ -203,9 +481,28 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindRealTimeCallback(T* instance) {
+            _realTimeViewCallback.unbind();
             _realTimeCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for Real-Time messages.
+         * @param callback Callback function to bind.
+         */
+        void BindRealTimeCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for Real-Time messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindRealTimeCallback(T* instance) {
+            _realTimeCallback.unbind();
+            _realTimeViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for System Common messages.
          * @param callback Callback function to bind.
@@ -220,9 +517,28 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindSystemCommonCallback(T* instance) {
+            _systemCommonViewCallback.unbind();
             _systemCommonCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for System Common messages.
+         * @param callback Callback function to bind.
+         */
+        void BindSystemCommonCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for System Common messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindSystemCommonCallback(T* instance) {
+            _systemCommonCallback.unbind();
+            _systemCommonViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for System Exclusive messages.
          * @param callback Callback function to bind.
@@ -237,11 +553,34 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindSysExCallback(T* instance) {
+            _sysExViewCallback.unbind();
             _sysExCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for System Exclusive messages.
+         * @param callback Callback function to bind.
+         */
+        void BindSysExCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for System Exclusive messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindSysExCallback(T* instance) {
+            _sysExCallback.unbind();
+            _sysExViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for MIDI Time Code messages.
+         *
+         * The callback receives Quarter Frame messages and Universal Real-Time MTC SysEx messages,
+         * such as Full Frame and User Bits. Check the first byte to tell them apart.
+         *
          * @param callback Callback function to bind.
          */
         void BindMTCCallback(CallbackType callback);
@@ -254,9 +593,28 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindMTCCallback(T* instance) {
+            _mtcViewCallback.unbind();
             _mtcCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for MIDI Time Code messages.
+         * @param callback Callback function to bind.
+         */
+        void BindMTCCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for MIDI Time Code messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindMTCCallback(T* instance) {
+            _mtcCallback.unbind();
+            _mtcViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for MIDI Show Control messages.
          * @param callback Callback function to bind.
@@ -271,9 +629,107 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindMSCCallback(T* instance) {
+            _mscViewCallback.unbind();
             _mscCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for MIDI Show Control messages.
+         * @param callback Callback function to bind.
+         */
+        void BindMSCCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for MIDI Show Control messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindMSCCallback(T* instance) {
+            _mscCallback.unbind();
+            _mscViewCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Binds a standalone callback for MIDI Machine Control messages.
+         *
+         * The callback receives Universal Real-Time SysEx MMC commands and responses.
+         *
+         * @param callback Callback function to bind.
+         */
+        void BindMMCCallback(CallbackType callback);
+
+        /**
+         * @brief Binds an instance method for MIDI Machine Control messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const uint8_t*, size_t)>
+        inline void BindMMCCallback(T* instance) {
+            _mmcViewCallback.unbind();
+            _mmcCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Binds a standalone `MessageView` callback for MIDI Machine Control messages.
+         * @param callback Callback function to bind.
+         */
+        void BindMMCCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for MIDI Machine Control messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindMMCCallback(T* instance) {
+            _mmcCallback.unbind();
+            _mmcViewCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Binds a standalone callback for Universal SysEx messages.
+         *
+         * The callback receives every Universal Real-Time and Non-Real-Time SysEx message, such as
+         * Device Inquiry or Sample Dump, and the MTC, MSC and MMC messages whose callback is not bound.
+         *
+         * @param callback Callback function to bind.
+         */
+        void BindUniversalSysExCallback(CallbackType callback);
+
+        /**
+         * @brief Binds an instance method for Universal SysEx messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const uint8_t*, size_t)>
+        inline void BindUniversalSysExCallback(T* instance) {
+            _universalSysExViewCallback.unbind();
+            _universalSysExCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Binds a standalone `MessageView` callback for Universal SysEx messages.
+         * @param callback Callback function to bind.
+         */
+        void BindUniversalSysExCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for Universal SysEx messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindUniversalSysExCallback(T* instance) {
+            _universalSysExCallback.unbind();
+            _universalSysExViewCallback.bind<T, Method>(instance);
+        }
+
         /**
          * @brief Binds a standalone callback for uncategorized or fallback messages.
          * @param callback Callback function to bind.
@@ -288,9 +744,92 @@ namespace MIDILAR::MidiCore {
          */
         template <typename T, void (T::*Method)(const uint8_t*, size_t)>
         inline void BindDefaultCallback(T* instance) {
+            _defaultViewCallback.unbind();
             _defaultCallback.bind<T, Method>(instance);
         }
 
+        /**
+         * @brief Binds a standalone `MessageView` callback for uncategorized or fallback messages.
+         * @param callback Callback function to bind.
+         */
+        void BindDefaultCallback(ViewCallbackType callback);
+
+        /**
+         * @brief Binds an instance method taking a `MessageView` for uncategorized or fallback messages.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const MessageView&)>
+        inline void BindDefaultCallback(T* instance) {
+            _defaultCallback.unbind();
+            _defaultViewCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Enables streamed SysEx delivery with a standalone callback.
+         *
+         * While a stream callback is bound, SysEx messages are no longer limited by the buffer size and
+         * are not passed to the SysEx or default callbacks. Instead, the callback receives the message
+         * in chunks as it arrives: whenever the internal buffer fills up, and at the end of every
+         * `ProcessData` call with SysEx bytes pending. Long runs of data bytes are passed straight
+         * from the input. Memory use is bounded by the buffer size, whatever the size of the message.
+         * With a batch callback also bound, the batch is flushed before each chunk, so both callbacks
+         * see the messages in arrival order.
+         *
+         * @param callback Callback receiving each chunk.
+         */
+        void BindSysExStreamCallback(SysExStreamCallbackType callback);
+
+        /**
+         * @brief Enables streamed SysEx delivery with an instance method.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         */
+        template <typename T, void (T::*Method)(const uint8_t*, size_t, SysExChunk)>
+        inline void BindSysExStreamCallback(T* instance) {
+            _sysExStreamCallback.bind<T, Method>(instance);
+        }
+
+        /**
+         * @brief Unbinds the SysEx stream callback and returns to whole-message SysEx delivery.
+         */
+        void UnbindSysExStreamCallback();
+
+        /**
+         * @brief Enables batched dispatch with a standalone callback.
+         *
+         * While a batch callback is bound, complete messages are appended to `Storage` instead of being
+         * dispatched through the category callbacks, and the callback receives the whole batch once at
+         * the end of every `ProcessData` call that produced messages. A batch that fills up is passed
+         * to the callback early and parsing continues with an empty batch. A message that cannot fit
+         * in an empty batch is dispatched through the category callbacks instead.
+         *
+         * @param callback Callback receiving each batch.
+         * @param Storage Batch to fill. It must outlive the binding.
+         */
+        void BindBatchCallback(BatchCallbackType callback, Batch& Storage);
+
+        /**
+         * @brief Enables batched dispatch with an instance method.
+         * @tparam T Class type of the instance.
+         * @tparam Method Member function to bind.
+         * @param instance Pointer to the instance that owns the method.
+         * @param Storage Batch to fill. It must outlive the binding.
+         */
+        template <typename T, void (T::*Method)(const Batch&)>
+        inline void BindBatchCallback(T* instance, Batch& Storage) {
+            _batchCallback.bind<T, Method>(instance);
+            _Batch = &Storage;
+            _Batch->Clear();
+        }
+
+        /**
+         * @brief Unbinds the batch callback and returns to per-message dispatch.
+         */
+        void UnbindBatchCallback();
+
         /**
          * @brief Unbinds the Channel Voice callback.
          */
@@ -326,6 +865,16 @@ namespace MIDILAR::MidiCore {
          */
         void UnbindMSCCallback();
 
+        /**
+         * @brief Unbinds the MIDI Machine Control callback.
+         */
+        void UnbindMMCCallback();
+
+        /**
+         * @brief Unbinds the Universal SysEx callback.
+         */
+        void UnbindUniversalSysExCallback();
+
         /**
          * @brief Unbinds the default callback.
          */
@@ -336,44 +885,151 @@ namespace MIDILAR::MidiCore {
          */
         void UnbindAll();
 
+        /**
+         * @brief Enables or disables running status decoding.
+         *
+         * When enabled, data bytes received while no message is in progress start a new Channel Voice
+         * message using the last Channel Voice status byte, as allowed by the MIDI specification.
+         * Real-Time bytes leave the running status untouched, System Common and SysEx bytes clear it.
+         *
+         * When disabled (the default), the parser keeps its legacy behaviour: every message must start
+         * with its status byte and data bytes without one are dropped.
+         *
+         * @param Enabled True to decode running status.
+         */
+        void SetRunningStatus(bool Enabled);
+
+        /**
+         * @brief Returns true if running status decoding is enabled.
+         */
+        bool RunningStatusEnabled() const;
+
+        /**
+         * @brief Sets the device ID Universal SysEx messages must address to reach their dedicated callbacks.
+         *
+         * Universal messages are routed to the MTC, MSC, MMC and Universal SysEx callbacks only when
+         * their device ID is `ID` or 0x7F (all call); messages for other devices are delivered as plain
+         * SysEx. The default, 0x7F, accepts every device ID.
+         *
+         * @param ID Device ID, 0x00 to 0x7F.
+         */
+        void SetDeviceID(uint8_t ID);
+
+        /**
+         * @brief Returns the device ID set with `SetDeviceID`.
+         */
+        uint8_t DeviceID() const;
+
+        /**
+         * @brief Clears the running status and discards any partially received message.
+         *
+         * A streamed SysEx in progress is reported as aborted.
+         */
+        void Reset();
+
         /**
          * @brief Processes a block of raw MIDI data.
          *
          * The input data is parsed byte by byte and grouped into complete MIDI messages.
          * When a message is completed, it is dispatched through the corresponding callback.
+         * Real-Time bytes are dispatched immediately, without interrupting the message in progress.
          *
          * @param data Pointer to the raw MIDI data buffer.
          * @param size Number of bytes available in the buffer.
          */
         void ProcessData(const uint8_t* data, size_t size);
 
-    private:
-
         /**
-         * @brief Handles an incoming MIDI status byte.
-         * @param data Status byte to process.
+         * @brief Processes a block of raw MIDI data received at a known time.
+         *
+         * The arrival time of every byte is interpolated from the first one: byte `i` arrived at
+         * `Time + i * BytePeriod`. Each message is stamped with the arrival time of its status byte,
+         * available from `MessageTime()` while it is dispatched. Drivers that timestamp the end of a
+         * chunk pass `End - (size - 1) * BytePeriod`.
+         *
+         * @param data Pointer to the raw MIDI data buffer.
+         * @param size Number of bytes available in the buffer.
+         * @param Time Arrival time of the first byte.
+         * @param BytePeriod Time taken by one byte on the wire, e.g. 320 us at the DIN MIDI baud rate.
          */
-        void _StatusByteHandler(uint8_t data);
+        void ProcessData(const uint8_t* data, size_t size, MIDILAR::SystemCore::Clock::TimePoint Time,
+                         MIDILAR::SystemCore::Clock::TimePoint BytePeriod);
 
         /**
-         * @brief Handles a completed Real-Time message.
+         * @brief Processes a block of raw MIDI data with the arrival time of every byte.
+         *
+         * Each message is stamped with the arrival time of its status byte, available from
+         * `MessageTime()` while it is dispatched.
+         *
+         * @param data Pointer to the raw MIDI data buffer.
+         * @param size Number of bytes available in the buffer.
+         * @param Times Arrival time of each byte, `size` elements, as reported by a UART or USB driver.
+         *              nullptr when the driver has no times for this block: the data is parsed untimed,
+         *              as by `ProcessData(data, size)`, and its messages are stamped 0.
          */
-        void _RealTimeHandler();
+        void ProcessData(const uint8_t* data, size_t size, const MIDILAR::SystemCore::Clock::TimePoint* Times);
 
         /**
-         * @brief Handles a completed Channel Voice message.
+         * @brief Returns the arrival time of the message being dispatched.
+         *
+         * Valid inside the callbacks. It is the time the status byte arrived, or the first data byte
+         * under running status, even when the message was completed by a later `ProcessData` call.
+         * Real-Time messages carry their own time. For streamed SysEx chunks it is the time of 0xF0.
+         * Messages parsed without a timestamp are stamped 0.
          */
-        void _ChannelVoiceHandler();
+        MIDILAR::SystemCore::Clock::TimePoint MessageTime() const;
+
+        #if defined(MIDILAR_MIDI_MESSAGE_BATCH)
+            /**
+             * @brief Processes every message stored in a `MessageBatch`.
+             *
+             * The batch arena is contiguous, so it is parsed in a single `ProcessData` call.
+             *
+             * @param batch The batch to parse.
+             */
+            void ProcessData(const MessageBatch& batch);
+        #endif
+
+        #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+            /**
+             * @brief Returns the current value of every counter.
+             *
+             * Safe to call from another thread while `ProcessData` runs. Each counter is read
+             * atomically, but the snapshot as a whole may mix values from before and after a message.
+             */
+            Statistics GetStatistics() const;
+
+            /**
+             * @brief Clears every counter.
+             *
+             * Call it from the thread running `ProcessData`: an update in progress on another thread
+             * may otherwise restore the value it read before the reset.
+             */
+            void ResetStatistics();
+        #endif
+
+    private:
 
         /**
-         * @brief Handles a completed System Common message.
+         * @brief Parses a block of data, the arrival time of byte `i` being `Times[i]`, or
+         *        `Time + i * BytePeriod` when `Times` is nullptr.
          */
-        void _SystemCommonHandler();
+        void _ProcessData(const uint8_t* data, size_t size, MIDILAR::SystemCore::Clock::TimePoint Time,
+                          MIDILAR::SystemCore::Clock::TimePoint BytePeriod, const MIDILAR::SystemCore::Clock::TimePoint* Times);
 
         /**
-         * @brief Handles a completed System Exclusive message.
+         * @brief Dispatches a complete message along its callback chain.
+         *
+         * Each route tries its own callback first, then the broader categories it belongs to, and
+         * finally the default callback. Universal SysEx messages go through a second lookup on their
+         * sub-ID: MTC, MSC or MMC first, then Universal SysEx, then SysEx.
+         *
+         * @param Route Callback chain of the message, taken from the status routing table.
+         * @param data Pointer to the complete message.
+         * @param size Size of the message in bytes.
+         * @param Time Arrival time of the message.
          */
-        void _SysExHandler();
+        void _Dispatch(uint8_t Route, const uint8_t* data, size_t size, MIDILAR::SystemCore::Clock::TimePoint Time);
     };
 
 }
@@ -0,0 +1,186 @@
+#ifndef MIDILAR_MIDI_PARSER_BANK_H
+#define MIDILAR_MIDI_PARSER_BANK_H
+
+#include <MIDILAR_BuildSettings.h>
+#include <SystemCore/CallbackHandler/CallbackHandler.h>
+#include <MidiCore/MessageParser/MessageParser.h>
+#include <MidiCore/Protocol/Scan.h>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace MIDILAR::MidiCore {
+
+    /**
+     * @class ParserBank
+     * @brief Parses the byte streams of many MIDI ports with a single set of callbacks.
+     *
+     * A `MessageParser` per port costs a heap buffer and a full set of callback handlers each. The
+     * bank keeps only the parsing state of every port, stored field by field in fixed arrays
+     * (message bytes, byte count, running status, SysEx progress), about 8 bytes per port and no
+     * allocation. Servicing many low-rate ports from one thread then touches a few cache lines
+     * instead of one parser object per port.
+     *
+     * Callbacks are shared by every port and receive the index of the port the message came from.
+     * They follow the same fallback chains as `MessageParser`: Control Change, then Channel Voice,
+     * then default; MIDI Time Code, then System Common, then default; Real-Time, then default.
+     * Running status and Real-Time bytes inside other messages are handled as in `MessageParser`.
+     *
+     * SysEx messages are never buffered: they are always streamed through the SysEx callback,
+     * straight from the input, in chunks marked as in `MessageParser::SysExChunk`. A chunk ends at
+     * 0xF7, before a Real-Time byte, and at the end of every `ProcessData` call. A SysEx interrupted
+     * by a status byte is reported as `Abort` if part of it was already delivered.
+     *
+     * ## Example Usage:
+     * ```cpp
+     * ParserBank<64> bank;
+     * bank.BindChannelVoiceCallback([](size_t Port, const uint8_t* data, size_t size) { Route(Port, data, size); });
+     *
+     * // For each chunk received from an input
+     * bank.ProcessData(port, chunk, length);
+     * ```
+     *
+     * @tparam Ports Number of ports in the bank.
+     */
+    template <size_t Ports>
+    class ParserBank {
+        static_assert(Ports > 0, "ParserBank needs at least one port");
+
+    public:
+        static constexpr size_t PortCount = Ports; ///< Number of ports in the bank.
+
+        /**
+         * @brief Callback type for complete messages: port index, message bytes and message size.
+         */
+        using CallbackType = MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t>::CallbackType;
+
+        /**
+         * @brief Callback type for SysEx chunks: port index, chunk bytes, chunk size and position in the message.
+         */
+        using SysExCallbackType = MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t, MessageParser::SysExChunk>::CallbackType;
+
+    private:
+        /**
+         * @brief Parsing state of a port.
+         */
+        enum _State : uint8_t {
+            _Idle = 0,      ///< Waiting for a status byte, or data bytes under running status.
+            _Message,       ///< Accumulating a Channel Voice or System Common message.
+            _SysEx          ///< Inside a SysEx message.
+        };
+
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _channelVoiceCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _controlChangeCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _realTimeCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _systemCommonCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _mtcCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t> _defaultCallback;
+        MIDILAR::SystemCore::CallbackHandler<void, size_t, const uint8_t*, size_t, MessageParser::SysExChunk> _sysExCallback;
+
+        uint8_t _States[Ports];         ///< `_State` of each port.
+        uint8_t _Sizes[Ports];          ///< Bytes received of the message in progress.
+        uint8_t _RunningStatus[Ports];  ///< Channel Voice status byte in effect, 0 when none.
+        bool _SysExStarted[Ports];      ///< True once a chunk of the SysEx in progress was delivered.
+        uint8_t _Messages[Ports][3];    ///< Message in progress; every message but SysEx fits in 3 bytes.
+        bool _RunningStatusEnabled;
+
+        /**
+         * @brief Dispatches a complete message along its callback chain.
+         */
+        void _Dispatch(size_t Port, const uint8_t* data, size_t size);
+
+        /**
+         * @brief Delivers a SysEx chunk of a port, skipping empty intermediate chunks.
+         */
+        void _SysExChunk(size_t Port, const uint8_t* data, size_t size, bool last);
+
+        /**
+         * @brief Reports the SysEx in progress on a port as aborted if part of it was delivered.
+         */
+        void _SysExAbort(size_t Port);
+
+    public:
+
+        /**
+         * @brief Constructs a bank with every port idle and running status disabled.
+         */
+        ParserBank();
+
+        /**
+         * @name Callback Binding
+         * @{
+         */
+            void BindChannelVoiceCallback(CallbackType callback) { _channelVoiceCallback.bind(callback); }    ///< Binds the Channel Voice callback.
+            void BindControlChangeCallback(CallbackType callback) { _controlChangeCallback.bind(callback); }  ///< Binds the Control Change callback.
+            void BindRealTimeCallback(CallbackType callback) { _realTimeCallback.bind(callback); }            ///< Binds the Real-Time callback.
+            void BindSystemCommonCallback(CallbackType callback) { _systemCommonCallback.bind(callback); }    ///< Binds the System Common callback.
+            void BindMTCCallback(CallbackType callback) { _mtcCallback.bind(callback); }                      ///< Binds the MIDI Time Code callback.
+            void BindDefaultCallback(CallbackType callback) { _defaultCallback.bind(callback); }              ///< Binds the default callback.
+            void BindSysExCallback(SysExCallbackType callback) { _sysExCallback.bind(callback); }             ///< Binds the SysEx chunk callback.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindChannelVoiceCallback(T* instance) { _channelVoiceCallback.template bind<T, Method>(instance); }   ///< Binds an instance method for Channel Voice messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindControlChangeCallback(T* instance) { _controlChangeCallback.template bind<T, Method>(instance); } ///< Binds an instance method for Control Change messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindRealTimeCallback(T* instance) { _realTimeCallback.template bind<T, Method>(instance); }           ///< Binds an instance method for Real-Time messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindSystemCommonCallback(T* instance) { _systemCommonCallback.template bind<T, Method>(instance); }   ///< Binds an instance method for System Common messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindMTCCallback(T* instance) { _mtcCallback.template bind<T, Method>(instance); }                     ///< Binds an instance method for MIDI Time Code messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t)>
+            void BindDefaultCallback(T* instance) { _defaultCallback.template bind<T, Method>(instance); }             ///< Binds an instance method for fallback messages.
+
+            template <typename T, void (T::*Method)(size_t, const uint8_t*, size_t, MessageParser::SysExChunk)>
+            void BindSysExCallback(T* instance) { _sysExCallback.template bind<T, Method>(instance); }                 ///< Binds an instance method for SysEx chunks.
+
+            void UnbindChannelVoiceCallback() { _channelVoiceCallback.unbind(); }     ///< Unbinds the Channel Voice callback.
+            void UnbindControlChangeCallback() { _controlChangeCallback.unbind(); }   ///< Unbinds the Control Change callback.
+            void UnbindRealTimeCallback() { _realTimeCallback.unbind(); }             ///< Unbinds the Real-Time callback.
+            void UnbindSystemCommonCallback() { _systemCommonCallback.unbind(); }     ///< Unbinds the System Common callback.
+            void UnbindMTCCallback() { _mtcCallback.unbind(); }                       ///< Unbinds the MIDI Time Code callback.
+            void UnbindDefaultCallback() { _defaultCallback.unbind(); }               ///< Unbinds the default callback.
+            void UnbindSysExCallback() { _sysExCallback.unbind(); }                   ///< Unbinds the SysEx chunk callback.
+            void UnbindAll();                                                         ///< Unbinds every callback.
+        /**@}*/
+
+        /**
+         * @brief Enables or disables running status decoding on every port, see `MessageParser::SetRunningStatus`.
+         */
+        void SetRunningStatus(bool Enabled);
+
+        /**
+         * @brief Returns true if running status decoding is enabled.
+         */
+        bool RunningStatusEnabled() const { return _RunningStatusEnabled; }
+
+        /**
+         * @brief Clears the running status of a port and discards its partially received message.
+         *
+         * A SysEx in progress is reported as aborted.
+         */
+        void Reset(size_t Port);
+
+        /**
+         * @brief Resets every port.
+         */
+        void Reset();
+
+        /**
+         * @brief Processes a block of raw MIDI data received on one port.
+         * @param Port Index of the port, blocks for ports out of range are ignored.
+         * @param data Pointer to the raw MIDI data buffer.
+         * @param size Number of bytes available in the buffer.
+         */
+        void ProcessData(size_t Port, const uint8_t* data, size_t size);
+    };
+
+}
+
+#include "ParserBank.tpp"
+
+#endif // MIDILAR_MIDI_PARSER_BANK_H
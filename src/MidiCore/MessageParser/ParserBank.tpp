@@ -0,0 +1,227 @@
+#include "ParserBank.h"
+
+namespace MIDILAR::MidiCore {
+
+    template <size_t Ports>
+    ParserBank<Ports>::ParserBank()
+        : _RunningStatusEnabled(false)
+    {
+        for (size_t port = 0; port < Ports; port++) {
+            _States[port] = _Idle;
+            _Sizes[port] = 0;
+            _RunningStatus[port] = 0;
+            _SysExStarted[port] = false;
+        }
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::UnbindAll() {
+        _channelVoiceCallback.unbind();
+        _controlChangeCallback.unbind();
+        _realTimeCallback.unbind();
+        _systemCommonCallback.unbind();
+        _mtcCallback.unbind();
+        _defaultCallback.unbind();
+        _sysExCallback.unbind();
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::SetRunningStatus(bool Enabled) {
+        _RunningStatusEnabled = Enabled;
+        for (size_t port = 0; port < Ports; port++) {
+            _RunningStatus[port] = 0;
+        }
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::Reset(size_t Port) {
+        if (Port >= Ports) {
+            return;
+        }
+        if (_States[Port] == _SysEx) {
+            _SysExAbort(Port);
+        }
+        _States[Port] = _Idle;
+        _Sizes[Port] = 0;
+        _RunningStatus[Port] = 0;
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::Reset() {
+        for (size_t port = 0; port < Ports; port++) {
+            Reset(port);
+        }
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::ProcessData(size_t Port, const uint8_t* data, size_t size) {
+        if (Port >= Ports || data == nullptr) {
+            return;
+        }
+
+        // Work on local copies of the port state and store them back once the block is parsed
+        uint8_t state = _States[Port];
+        uint8_t count = _Sizes[Port];
+        uint8_t running = _RunningStatus[Port];
+        uint8_t* message = _Messages[Port];
+        size_t chunk = 0; // Start of the SysEx bytes not delivered yet
+
+        for (size_t i = 0; i < size; i++) {
+            uint8_t byte = data[i];
+
+            if (byte < 0x80) {
+                if (state == _SysEx) {
+                    i += MidiProtocol::Scan::DataRunLength(data + i, size - i) - 1; // Delivered with the chunk
+                    continue;
+                }
+
+                if (state == _Idle) {
+                    if (running == 0) {
+                        i += MidiProtocol::Scan::DataRunLength(data + i, size - i) - 1;
+                        continue; // No status in effect, drop the bytes up to the next status byte
+                    }
+                    message[0] = running;
+                    count = 1;
+                    state = _Message;
+                }
+
+                message[count++] = byte;
+                if (count == MidiProtocol::StatusTable[message[0]].Size) {
+                    _Dispatch(Port, message, count);
+                    state = _Idle;
+                    count = 0;
+                }
+                continue;
+            }
+
+            const MidiProtocol::StatusInfo& info = MidiProtocol::StatusTable[byte];
+
+            // Real-Time bytes leave the message in progress untouched and split the SysEx chunk around them
+            if (byte >= MIDI_REALTIME_TIMING_TICK) {
+                if (info.Category == MidiProtocol::MessageCategory::RealTime) {
+                    if (state == _SysEx) {
+                        _SysExChunk(Port, data + chunk, i - chunk, false);
+                        chunk = i + 1;
+                    }
+                    _Dispatch(Port, data + i, 1);
+                }
+                continue;
+            }
+
+            if (state == _SysEx) {
+                if (byte == MIDI_SYSEX_END) {
+                    _SysExChunk(Port, data + chunk, i + 1 - chunk, true);
+                    state = _Idle;
+                    continue;
+                }
+                _SysExAbort(Port);
+            }
+
+            running = (_RunningStatusEnabled && byte < MIDI_SYSEX_START) ? byte : 0;
+            state = _Idle;
+            count = 0;
+
+            if (byte == MIDI_SYSEX_START) {
+                state = _SysEx;
+                chunk = i;
+                continue;
+            }
+
+            if (info.Size == 0) {
+                continue; // Undefined status bytes (0xF4, 0xF5) and 0xF7 outside a SysEx
+            }
+
+            // Fast path: the complete message is in the input, dispatch it in place
+            if (info.Size > 1 && info.Size <= size - i && data[i + 1] < 0x80 && (info.Size == 2 || data[i + 2] < 0x80)) {
+                _Dispatch(Port, data + i, info.Size);
+                i += info.Size - 1;
+                continue;
+            }
+
+            if (info.Size == 1) { // Tuning Request
+                _Dispatch(Port, data + i, 1);
+                continue;
+            }
+
+            message[0] = byte;
+            count = 1;
+            state = _Message;
+        }
+
+        // Hand over the SysEx bytes received in this block
+        if (state == _SysEx) {
+            _SysExChunk(Port, data + chunk, size - chunk, false);
+        }
+
+        _States[Port] = state;
+        _Sizes[Port] = count;
+        _RunningStatus[Port] = running;
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::_Dispatch(size_t Port, const uint8_t* data, size_t size) {
+        const MidiProtocol::StatusInfo& info = MidiProtocol::StatusTable[data[0]];
+
+        // A callback that is not bound falls through to the broader one below it, then to the default callback
+        switch (info.Category) {
+            case MidiProtocol::MessageCategory::ChannelVoice:
+                if (info.Kind == MidiProtocol::MessageKind::ControlChange && _controlChangeCallback.status()) {
+                    _controlChangeCallback.invoke(Port, data, size);
+                    return;
+                }
+                if (_channelVoiceCallback.status()) {
+                    _channelVoiceCallback.invoke(Port, data, size);
+                    return;
+                }
+                break;
+
+            case MidiProtocol::MessageCategory::SystemCommon:
+                if (info.Kind == MidiProtocol::MessageKind::MTCQuarterFrame && _mtcCallback.status()) {
+                    _mtcCallback.invoke(Port, data, size);
+                    return;
+                }
+                if (_systemCommonCallback.status()) {
+                    _systemCommonCallback.invoke(Port, data, size);
+                    return;
+                }
+                break;
+
+            case MidiProtocol::MessageCategory::RealTime:
+                if (_realTimeCallback.status()) {
+                    _realTimeCallback.invoke(Port, data, size);
+                    return;
+                }
+                break;
+
+            default: break;
+        }
+
+        if (_defaultCallback.status()) {
+            _defaultCallback.invoke(Port, data, size);
+        }
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::_SysExChunk(size_t Port, const uint8_t* data, size_t size, bool last) {
+        if (size == 0 && !last) {
+            return;
+        }
+
+        bool started = _SysExStarted[Port];
+        MessageParser::SysExChunk chunk = started ? (last ? MessageParser::SysExChunk::End : MessageParser::SysExChunk::Continue)
+                                                  : (last ? MessageParser::SysExChunk::Complete : MessageParser::SysExChunk::Start);
+        _SysExStarted[Port] = !last;
+        if (_sysExCallback.status()) {
+            _sysExCallback.invoke(Port, data, size, chunk);
+        }
+    }
+
+    template <size_t Ports>
+    void ParserBank<Ports>::_SysExAbort(size_t Port) {
+        if (_SysExStarted[Port] && _sysExCallback.status()) {
+            _sysExCallback.invoke(Port, nullptr, 0, MessageParser::SysExChunk::Abort);
+        }
+        _SysExStarted[Port] = false;
+    }
+
+}
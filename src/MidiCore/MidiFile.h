@@ -0,0 +1,12 @@
+#ifndef MIDILAR_MIDI_FILE_TOP_H
+#define MIDILAR_MIDI_FILE_TOP_H
+
+    #include <MIDILAR_BuildSettings.h>
+    
+    #if __has_include(<MidiCore/MidiFile/MidiFileWriter.h>)
+        #define MIDILAR_MIDI_FILE
+        #include <MidiCore/MidiFile/MidiFileReader.h>
+        #include <MidiCore/MidiFile/MidiFileWriter.h>
+    #endif
+
+#endif//MIDILAR_MIDI_FILE_TOP_H
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef MIDILAR_MIDI_FILE_FORMAT_H
+#define MIDILAR_MIDI_FILE_FORMAT_H
+
+/**
+ * @file MidiFileFormat.h
+ * @brief Constants and variable-length quantity helpers of the Standard MIDI File format.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    /**
+     * @namespace MIDILAR::MidiCore::MidiFile
+     * @brief Standard MIDI File (SMF) format definitions.
+     */
+    namespace MIDILAR::MidiCore::MidiFile {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Chunks
+
+            static constexpr uint8_t HeaderChunkID[4] = {'M', 'T', 'h', 'd'};  ///< Header chunk type.
+            static constexpr uint8_t TrackChunkID[4] = {'M', 'T', 'r', 'k'};   ///< Track chunk type.
+            static constexpr size_t ChunkHeaderSize = 8;                        ///< Chunk type and 32-bit length.
+            static constexpr size_t HeaderSize = 14;                            ///< Complete header chunk.
+
+            /**
+             * @brief File format stored in the header chunk.
+             */
+            enum class Format : uint16_t {
+                SingleTrack = 0,    ///< Type 0: one track holding every channel.
+                MultiTrack = 1,     ///< Type 1: simultaneous tracks sharing the tempo map of the first track.
+                MultiSong = 2       ///< Type 2: independent sequential patterns.
+            };
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Events
+
+            static constexpr uint8_t MetaEvent = 0xFF;      ///< Introduces a meta event inside a track.
+            static constexpr uint8_t SysExEvent = 0xF0;     ///< Introduces a System Exclusive event.
+            static constexpr uint8_t EscapeEvent = 0xF7;    ///< Introduces raw bytes sent as is (SysEx continuation, real-time, system common).
+
+            /**
+             * @brief Meta event types.
+             */
+            enum class MetaType : uint8_t {
+                SequenceNumber      = 0x00,
+                Text                = 0x01,
+                Copyright           = 0x02,
+                TrackName           = 0x03,
+                InstrumentName      = 0x04,
+                Lyric               = 0x05,
+                Marker              = 0x06,
+                CuePoint            = 0x07,
+                ChannelPrefix       = 0x20,
+                EndOfTrack          = 0x2F,
+                Tempo               = 0x51,     ///< 24-bit microseconds per quarter note.
+                SMPTEOffset         = 0x54,
+                TimeSignature       = 0x58,
+                KeySignature        = 0x59,
+                SequencerSpecific   = 0x7F
+            };
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Variable-Length Quantities
+
+            static constexpr uint32_t MaxVariableLength = 0x0FFFFFFF;   ///< Largest value a 4 byte variable-length quantity can hold.
+            static constexpr size_t MaxVariableLengthSize = 4;          ///< Largest encoded size of a variable-length quantity.
+
+            /**
+             * @brief Returns the number of bytes needed to encode a value as a variable-length quantity.
+             */
+            constexpr size_t VariableLengthSize(uint32_t Value) {
+                return (Value < (1u << 7)) ? 1 : (Value < (1u << 14)) ? 2 : (Value < (1u << 21)) ? 3 : 4;
+            }
+
+            /**
+             * @brief Writes a variable-length quantity, most significant group first.
+             * @param Out Destination, at least `VariableLengthSize(Value)` bytes.
+             * @param Value Value to encode, clamped to `MaxVariableLength`.
+             * @return Number of bytes written.
+             */
+            inline size_t WriteVariableLength(uint8_t* Out, uint32_t Value) {
+                Value = (Value < MaxVariableLength) ? Value : MaxVariableLength;
+                size_t size = VariableLengthSize(Value);
+
+                for (size_t i = 0; i < size; i++) {
+                    uint8_t group = static_cast<uint8_t>((Value >> (7 * (size - 1 - i))) & 0x7F);
+                    Out[i] = (i + 1 < size) ? (group | 0x80) : group;
+                }
+                return size;
+            }
+
+            /**
+             * @brief Reads a variable-length quantity.
+             * @param Data Encoded bytes.
+             * @param Size Number of bytes available.
+             * @param Value Receives the decoded value.
+             * @return Number of bytes consumed, 0 if the quantity is truncated or longer than 4 bytes.
+             */
+            inline size_t ReadVariableLength(const uint8_t* Data, size_t Size, uint32_t& Value) {
+                uint32_t value = 0;
+
+                for (size_t i = 0; i < Size && i < MaxVariableLengthSize; i++) {
+                    value = (value << 7) | (Data[i] & 0x7F);
+                    if ((Data[i] & 0x80) == 0) {
+                        Value = value;
+                        return i + 1;
+                    }
+                }
+                return 0;
+            }
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+#endif//MIDILAR_MIDI_FILE_FORMAT_H
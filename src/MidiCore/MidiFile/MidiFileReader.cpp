@@ -0,0 +1,340 @@
+#include "MidiFileReader.h"
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+    #define MIDILAR_MIDI_FILE_MMAP
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#elif defined(_WIN32) && __has_include(<windows.h>)
+    #define MIDILAR_MIDI_FILE_WIN32_MAPPING
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif __has_include(<stdio.h>)
+    #include <stdio.h>
+#endif
+
+namespace MIDILAR::MidiCore{
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        uint32_t _readBigEndian(const uint8_t* Data, size_t Size) {
+            uint32_t value = 0;
+            for (size_t i = 0; i < Size; i++) {
+                value = (value << 8) | Data[i];
+            }
+            return value;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Iterator
+
+        MidiFileReader::const_iterator::const_iterator(const uint8_t* Data, size_t Size)
+            : _Position(Data), _Next(Data), _End(Data + Size), _Tick(0), _RunningStatus(0), _Ended(Data == nullptr) {
+            _decode();
+        }
+
+        void MidiFileReader::const_iterator::_decode() {
+            if (_Ended || _Position == nullptr || _Position >= _End) {
+                _Position = nullptr;
+                return;
+            }
+
+            size_t available = static_cast<size_t>(_End - _Position);
+            uint32_t delta = 0;
+            size_t consumed = MidiFile::ReadVariableLength(_Position, available, delta);
+            if (consumed == 0 || consumed >= available) {
+                _Position = nullptr; // Truncated delta time
+                return;
+            }
+
+            const uint8_t* event = _Position + consumed;
+            available -= consumed;
+            uint8_t status = event[0];
+            Event& out = _Event;
+            out._Inline = false;
+
+            if (status == MidiFile::MetaEvent || status == MidiFile::SysExEvent || status == MidiFile::EscapeEvent) {
+                // Meta: FF <type> <length> <data>, SysEx and escape: F0|F7 <length> <data>
+                size_t header = (status == MidiFile::MetaEvent) ? 2 : 1;
+                uint32_t length = 0;
+                consumed = (available > header) ? MidiFile::ReadVariableLength(event + header, available - header, length) : 0;
+                if (consumed == 0 || length > available - header - consumed) {
+                    _Position = nullptr; // Truncated event
+                    return;
+                }
+
+                out._Data = event + header + consumed;
+                out._Size = length;
+                if (status == MidiFile::MetaEvent) {
+                    out._Type = EventType::Meta;
+                    out._MetaType = static_cast<MidiFile::MetaType>(event[1]);
+                    _Ended = (out._MetaType == MidiFile::MetaType::EndOfTrack);
+                } else {
+                    out._Type = (status == MidiFile::SysExEvent) ? EventType::SysEx : EventType::Escape;
+                }
+                _Next = out._Data + length;
+
+            } else if (status >= 0x80) {
+                if (status >= MIDI_SYSEX_START) {
+                    _Position = nullptr; // System messages only appear inside SysEx or escape events
+                    return;
+                }
+
+                size_t size = Protocol::StatusTable[status].Size;
+                if (size > available) {
+                    _Position = nullptr;
+                    return;
+                }
+
+                out._Type = EventType::Midi;
+                out._Data = event;
+                out._Size = size;
+                _RunningStatus = status;
+                _Next = event + size;
+
+            } else {
+                // Running status: the status byte is omitted, rebuild the complete message
+                if (_RunningStatus == 0) {
+                    _Position = nullptr; // Data byte without a status in effect
+                    return;
+                }
+
+                size_t size = Protocol::StatusTable[_RunningStatus].Size;
+                if (size - 1 > available) {
+                    _Position = nullptr;
+                    return;
+                }
+
+                out._Type = EventType::Midi;
+                out._Short[0] = _RunningStatus;
+                memcpy(out._Short + 1, event, size - 1);
+                out._Inline = true;
+                out._Data = nullptr;
+                out._Size = size;
+                _Next = event + size - 1;
+            }
+
+            _Tick += delta;
+            out._Tick = _Tick;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+
+        bool MidiFileReader::_index() {
+            if (_Size < MidiFile::HeaderSize || memcmp(_Data, MidiFile::HeaderChunkID, 4) != 0) {
+                return false;
+            }
+
+            uint32_t header_length = _readBigEndian(_Data + 4, 4);
+            if (header_length < 6 || header_length > _Size - MidiFile::ChunkHeaderSize) {
+                return false;
+            }
+
+            _Format = static_cast<MidiFile::Format>(_readBigEndian(_Data + 8, 2));
+            size_t declared = _readBigEndian(_Data + 10, 2);
+            _Division = static_cast<uint16_t>(_readBigEndian(_Data + 12, 2));
+
+            if (declared > 0) {
+                _Tracks = static_cast<Track*>(malloc(declared * sizeof(Track)));
+                if (_Tracks == nullptr) {
+                    return false; // Memory allocation failed
+                }
+            }
+
+            // Only the chunk headers are read here; track bodies are decoded while iterating
+            size_t offset = MidiFile::ChunkHeaderSize + header_length;
+            while (_TrackCount < declared && offset + MidiFile::ChunkHeaderSize <= _Size) {
+                const uint8_t* chunk = _Data + offset;
+                size_t length = _readBigEndian(chunk + 4, 4);
+                size_t available = _Size - offset - MidiFile::ChunkHeaderSize;
+                if (length > available) {
+                    length = available; // Truncated file, keep what is there
+                }
+
+                // Chunks with an unknown type are skipped, as required by the format
+                if (memcmp(chunk, MidiFile::TrackChunkID, 4) == 0) {
+                    _Tracks[_TrackCount++] = Track(chunk + MidiFile::ChunkHeaderSize, length);
+                }
+                offset += MidiFile::ChunkHeaderSize + length;
+            }
+            return true;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Construction and Opening
+
+        MidiFileReader::MidiFileReader() noexcept
+            : _Data(nullptr), _Size(0), _Mapping(nullptr), _Source(_Storage::None), _Tracks(nullptr), _TrackCount(0),
+              _Format(MidiFile::Format::SingleTrack), _Division(0) {}
+
+        MidiFileReader::~MidiFileReader() {
+            Close();
+        }
+
+        bool MidiFileReader::Open(const uint8_t* Data, size_t Size) {
+            Close();
+            if (Data == nullptr) {
+                return false;
+            }
+
+            _Data = Data;
+            _Size = Size;
+            _Source = _Storage::External;
+            if (!_index()) {
+                Close();
+                return false;
+            }
+            return true;
+        }
+
+        bool MidiFileReader::Open(const char* Path) {
+            Close();
+            if (Path == nullptr) {
+                return false;
+            }
+
+            #if defined(MIDILAR_MIDI_FILE_MMAP)
+                int file = open(Path, O_RDONLY);
+                if (file < 0) {
+                    return false;
+                }
+
+                struct stat info;
+                if (fstat(file, &info) != 0 || info.st_size <= 0) {
+                    ::close(file);
+                    return false;
+                }
+
+                size_t size = static_cast<size_t>(info.st_size);
+                void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+                ::close(file); // The mapping keeps its own reference to the file
+                if (data == MAP_FAILED) {
+                    return false;
+                }
+
+                _Data = static_cast<const uint8_t*>(data);
+                _Size = size;
+                _Source = _Storage::Mapped;
+
+            #elif defined(MIDILAR_MIDI_FILE_WIN32_MAPPING)
+                HANDLE file = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE) {
+                    return false;
+                }
+
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0) {
+                    CloseHandle(file);
+                    return false;
+                }
+
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(file); // The mapping keeps its own reference to the file
+                if (mapping == nullptr) {
+                    return false;
+                }
+
+                void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (data == nullptr) {
+                    CloseHandle(mapping);
+                    return false;
+                }
+
+                _Data = static_cast<const uint8_t*>(data);
+                _Size = static_cast<size_t>(file_size.QuadPart);
+                _Mapping = mapping;
+                _Source = _Storage::Mapped;
+
+            #elif __has_include(<stdio.h>)
+                FILE* file = fopen(Path, "rb");
+                if (file == nullptr) {
+                    return false;
+                }
+
+                long size = (fseek(file, 0, SEEK_END) == 0) ? ftell(file) : -1;
+                uint8_t* data = (size > 0) ? static_cast<uint8_t*>(malloc(static_cast<size_t>(size))) : nullptr;
+                bool ok = data != nullptr && fseek(file, 0, SEEK_SET) == 0 &&
+                          fread(data, 1, static_cast<size_t>(size), file) == static_cast<size_t>(size);
+                fclose(file);
+                if (!ok) {
+                    free(data);
+                    return false;
+                }
+
+                _Data = data;
+                _Size = static_cast<size_t>(size);
+                _Source = _Storage::Allocated;
+
+            #else
+                return false; // No file access on this platform, use Open(Data, Size)
+            #endif
+
+            if (!_index()) {
+                Close();
+                return false;
+            }
+            return true;
+        }
+
+        void MidiFileReader::Close() {
+            switch (_Source) {
+                #if defined(MIDILAR_MIDI_FILE_MMAP)
+                    case _Storage::Mapped:
+                        munmap(const_cast<uint8_t*>(_Data), _Size);
+                        break;
+                #elif defined(MIDILAR_MIDI_FILE_WIN32_MAPPING)
+                    case _Storage::Mapped:
+                        UnmapViewOfFile(_Data);
+                        CloseHandle(static_cast<HANDLE>(_Mapping));
+                        break;
+                #endif
+                case _Storage::Allocated:
+                    free(const_cast<uint8_t*>(_Data));
+                    break;
+                default:
+                    break;
+            }
+
+            free(_Tracks);
+            _Tracks = nullptr;
+            _TrackCount = 0;
+            _Data = nullptr;
+            _Size = 0;
+            _Mapping = nullptr;
+            _Source = _Storage::None;
+        }
+
+        bool MidiFileReader::IsOpen() const {
+            return _Source != _Storage::None;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // File Information
+
+        MidiFile::Format MidiFileReader::FileFormat() const {
+            return _Format;
+        }
+
+        uint16_t MidiFileReader::Division() const {
+            return _Division;
+        }
+
+        size_t MidiFileReader::TrackCount() const {
+            return _TrackCount;
+        }
+
+        MidiFileReader::Track MidiFileReader::GetTrack(size_t Index) const {
+            return (Index < _TrackCount) ? _Tracks[Index] : Track();
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
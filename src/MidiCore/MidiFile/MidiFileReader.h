@@ -0,0 +1,229 @@
+#ifndef MIDILAR_MIDI_FILE_READER_H
+#define MIDILAR_MIDI_FILE_READER_H
+
+/**
+ * @file MidiFileReader.h
+ * @brief Provides the `MidiFileReader` class for iterating the events of a Standard MIDI File in place.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Protocol/StatusTable.h>
+    #include <MidiCore/Message/MessageView.h>
+    #include <MidiCore/MidiFile/MidiFileFormat.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class MidiFileReader
+         * @brief Reads a Standard MIDI File without copying or pre-decoding it.
+         *
+         * Opening a file maps it into memory and only walks the chunk headers to locate each track,
+         * so the cost of `Open()` does not depend on the number of events. Events are decoded while
+         * iterating a track: the delta time, running status and meta/SysEx lengths are resolved one
+         * event at a time, and no memory is allocated per event.
+         *
+         * Each event exposes its absolute time in ticks and its bytes. Channel Voice events point
+         * directly into the file, except when running status omitted the status byte: the complete
+         * message is then rebuilt inside the iterator. Events stay valid until the iterator moves.
+         *
+         * Running status is kept across meta and SysEx events, which some files in the wild rely on;
+         * files that follow the specification are read the same way.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * MidiFileReader reader;
+         * if (reader.Open("song.mid")) {
+         *     for (const MidiFileReader::Event& e : reader.GetTrack(1)) {
+         *         if (e.Type() == MidiFileReader::EventType::Midi) {
+         *             Schedule(e.Tick(), e.View());
+         *         }
+         *     }
+         * }
+         * ```
+         *
+         * @note Iteration stops after the End of Track meta event, at the end of the chunk, or at the
+         *       first malformed event.
+         */
+            class MidiFileReader {
+
+            public:
+
+                /**
+                 * @brief Kind of event stored in a track.
+                 */
+                enum class EventType : uint8_t {
+                    Midi,       ///< Channel Voice message; `Data()` holds the complete message.
+                    SysEx,      ///< SysEx event; `Data()` holds the bytes following 0xF0, normally ending with 0xF7.
+                    Escape,     ///< Escape (0xF7) event; `Data()` holds the raw bytes to send.
+                    Meta        ///< Meta event; `Data()` holds the meta data and `MetaType()` its type.
+                };
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @class Event
+                * @brief A single decoded track event.
+                */
+                    class Event {
+                        friend class MidiFileReader;
+
+                    private:
+                        const uint8_t* _Data;           ///< Event bytes inside the file.
+                        size_t _Size;                   ///< Number of event bytes.
+                        uint32_t _Tick;                 ///< Absolute time in ticks.
+                        EventType _Type;
+                        MidiFile::MetaType _MetaType;
+                        bool _Inline;                   ///< True when the bytes are in `_Short` (running status).
+                        uint8_t _Short[3];              ///< Channel Voice message rebuilt from running status.
+
+                    public:
+                        constexpr Event() noexcept
+                            : _Data(nullptr), _Size(0), _Tick(0), _Type(EventType::Midi), _MetaType(MidiFile::MetaType::Text), _Inline(false), _Short{0, 0, 0} {}
+
+                        uint32_t Tick() const noexcept { return _Tick; }                                    ///< Returns the absolute time in ticks.
+                        EventType Type() const noexcept { return _Type; }                                   ///< Returns the kind of event.
+                        MidiFile::MetaType MetaType() const noexcept { return _MetaType; }                  ///< Returns the meta event type, only meaningful for meta events.
+                        const uint8_t* Data() const noexcept { return _Inline ? _Short : _Data; }           ///< Returns the event bytes, see `EventType`.
+                        size_t size() const noexcept { return _Size; }                                      ///< Returns the number of event bytes.
+
+                        /**
+                         * @brief Returns a view of the event as a MIDI message.
+                         * @return The message for `Midi` and `Escape` events, an empty view otherwise.
+                         */
+                        MessageView View() const noexcept {
+                            return (_Type == EventType::Midi || _Type == EventType::Escape) ? MessageView(Data(), _Size) : MessageView();
+                        }
+                    };
+               //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @class const_iterator
+                * @brief Forward iterator decoding the events of a track one at a time.
+                */
+                    class const_iterator {
+                        friend class MidiFileReader;
+
+                    private:
+                        const uint8_t* _Position;   ///< Start of the current event, nullptr at the end.
+                        const uint8_t* _Next;       ///< Start of the following event.
+                        const uint8_t* _End;        ///< End of the track chunk.
+                        uint32_t _Tick;             ///< Absolute time of the current event.
+                        uint8_t _RunningStatus;     ///< Status byte in effect, 0 when none.
+                        bool _Ended;                ///< True once the End of Track meta event is reached.
+                        Event _Event;
+
+                        const_iterator(const uint8_t* Data, size_t Size);
+                        void _decode(); ///< Decodes the event at `_Position`, or moves to the end.
+
+                    public:
+                        const_iterator() noexcept : _Position(nullptr), _Next(nullptr), _End(nullptr), _Tick(0), _RunningStatus(0), _Ended(true) {} ///< Constructs an end iterator.
+
+                        const Event& operator*() const { return _Event; }
+                        const Event* operator->() const { return &_Event; }
+                        const_iterator& operator++() { _Position = _Next; _decode(); return *this; }
+                        const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+                        bool operator==(const const_iterator& Other) const { return _Position == Other._Position; }
+                        bool operator!=(const const_iterator& Other) const { return !(*this == Other); }
+                    };
+               //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @class Track
+                * @brief Range over the events of one track chunk.
+                */
+                    class Track {
+                    private:
+                        const uint8_t* _Data;   ///< Track chunk body inside the file.
+                        size_t _Size;           ///< Length of the track chunk body.
+
+                    public:
+                        constexpr Track() noexcept : _Data(nullptr), _Size(0) {}
+                        constexpr Track(const uint8_t* Data, size_t Size) noexcept : _Data(Data), _Size(Data ? Size : 0) {}
+
+                        const uint8_t* Data() const noexcept { return _Data; }  ///< Returns the encoded track body.
+                        size_t size() const noexcept { return _Size; }          ///< Returns the length of the encoded track body.
+                        bool empty() const noexcept { return _Size == 0; }      ///< Returns true if the track holds no bytes.
+
+                        const_iterator begin() const { return const_iterator(_Data, _Size); }
+                        const_iterator end() const { return const_iterator(); }
+                    };
+               //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            private:
+                enum class _Storage : uint8_t {
+                    None,       ///< Nothing open.
+                    External,   ///< Buffer owned by the caller.
+                    Mapped,     ///< File mapped into memory.
+                    Allocated   ///< File read into a heap buffer, where mapping is not available.
+                };
+
+                const uint8_t* _Data;       ///< Complete file contents.
+                size_t _Size;               ///< Size of the file in bytes.
+                void* _Mapping;             ///< Platform mapping handle, when the platform needs one.
+                _Storage _Source;
+                Track* _Tracks;             ///< Location of each track chunk.
+                size_t _TrackCount;
+                MidiFile::Format _Format;
+                uint16_t _Division;
+
+                bool _index(); ///< Reads the header chunk and locates the track chunks.
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Construction and Opening
+                * @{
+                */
+                    MidiFileReader() noexcept;
+                    ~MidiFileReader();
+
+                    MidiFileReader(const MidiFileReader&) = delete;
+                    MidiFileReader& operator=(const MidiFileReader&) = delete;
+
+                    /**
+                     * @brief Opens a file held in memory, without copying it.
+                     * @param Data File contents. They must outlive the reader and every iterator taken from it.
+                     * @param Size Size of the file in bytes.
+                     * @return False if the data does not start with a valid header chunk.
+                     */
+                    bool Open(const uint8_t* Data, size_t Size);
+
+                    /**
+                     * @brief Maps a file into memory and opens it.
+                     *
+                     * The file is mapped read-only where the platform supports it, so pages are only
+                     * loaded when the tracks are iterated. Other platforms read it into a heap buffer.
+                     *
+                     * @return False if the file cannot be read or is not a Standard MIDI File.
+                     */
+                    bool Open(const char* Path);
+
+                    void Close();           ///< Releases the file. Tracks and iterators taken from it become invalid.
+                    bool IsOpen() const;    ///< Returns true if a file is open.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name File Information
+                * @{
+                */
+                    MidiFile::Format FileFormat() const;    ///< Returns the file format from the header chunk.
+                    uint16_t Division() const;              ///< Returns the raw division field: ticks per quarter note, or SMPTE timing when bit 15 is set.
+                    size_t TrackCount() const;              ///< Returns the number of track chunks found.
+                    Track GetTrack(size_t Index) const;     ///< Returns a track, or an empty track if `Index` is out of range.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_FILE_READER_H
@@ -0,0 +1,312 @@
+#include "MidiFileWriter.h"
+
+namespace MIDILAR::MidiCore{
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        void _writeBigEndian(uint8_t* Out, uint32_t Value, size_t Size) {
+            for (size_t i = 0; i < Size; i++) {
+                Out[i] = static_cast<uint8_t>(Value >> (8 * (Size - 1 - i)));
+            }
+        }
+
+        constexpr size_t _endOfTrackSize = 4; ///< Delta time 0 followed by FF 2F 00.
+
+        #if __has_include(<stdio.h>)
+            void _fileSink(void* Context, const uint8_t* Data, size_t Size) {
+                fwrite(Data, 1, Size, static_cast<FILE*>(Context));
+            }
+        #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+
+        uint8_t* MidiFileWriter::_begin(size_t Track, uint32_t Tick, size_t Size) {
+            if (Track >= _TrackCount || _Tracks[Track].Ended) {
+                return nullptr;
+            }
+
+            _Track& track = _Tracks[Track];
+            uint32_t delta = (Tick > track.Tick) ? (Tick - track.Tick) : 0;
+            if (delta > MidiFile::MaxVariableLength) {
+                return nullptr; // Not representable as a single delta time
+            }
+
+            size_t required = track.Size + MidiFile::VariableLengthSize(delta) + Size;
+            if (required > track.Capacity) {
+                size_t new_capacity = (track.Capacity == 0) ? 256 : track.Capacity;
+                while (new_capacity < required) {
+                    new_capacity *= 2;
+                }
+
+                uint8_t* new_data = static_cast<uint8_t*>(realloc(track.Data, new_capacity));
+                if (new_data == nullptr) {
+                    return nullptr; // Memory allocation failed
+                }
+                track.Data = new_data;
+                track.Capacity = new_capacity;
+            }
+
+            track.Size += MidiFile::WriteVariableLength(track.Data + track.Size, delta);
+            track.Tick += delta;
+
+            uint8_t* dest = track.Data + track.Size;
+            track.Size += Size;
+            return dest;
+        }
+
+        bool MidiFileWriter::_write(void (*Sink)(void*, const uint8_t*, size_t), void* Context) {
+            for (size_t i = 0; i < _TrackCount; i++) {
+                if (!_Tracks[i].Ended && !EndOfTrack(i, _Tracks[i].Tick)) {
+                    return false;
+                }
+                if (_Tracks[i].Size > UINT32_MAX) {
+                    return false; // Chunk length does not fit the format
+                }
+            }
+
+            uint8_t header[MidiFile::HeaderSize];
+            memcpy(header, MidiFile::HeaderChunkID, 4);
+            _writeBigEndian(header + 4, 6, 4);
+            _writeBigEndian(header + 8, static_cast<uint16_t>(_Format), 2);
+            _writeBigEndian(header + 10, static_cast<uint32_t>(_TrackCount), 2);
+            _writeBigEndian(header + 12, _Division, 2);
+            Sink(Context, header, sizeof(header));
+
+            for (size_t i = 0; i < _TrackCount; i++) {
+                uint8_t chunk[MidiFile::ChunkHeaderSize];
+                memcpy(chunk, MidiFile::TrackChunkID, 4);
+                _writeBigEndian(chunk + 4, static_cast<uint32_t>(_Tracks[i].Size), 4);
+
+                Sink(Context, chunk, sizeof(chunk));
+                Sink(Context, _Tracks[i].Data, _Tracks[i].Size);
+            }
+            return true;
+        }
+
+        void MidiFileWriter::_outputSink(void* Context, const uint8_t* Data, size_t Size) {
+            static_cast<MidiFileWriter*>(Context)->_Output.invoke(Data, Size);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Construction and Tracks
+
+        MidiFileWriter::MidiFileWriter(MidiFile::Format FileFormat, uint16_t Division)
+            : _Tracks(nullptr), _TrackCount(0), _TrackCapacity(0), _Format(FileFormat), _Division(Division) {}
+
+        MidiFileWriter::~MidiFileWriter() {
+            Clear();
+            free(_Tracks);
+        }
+
+        size_t MidiFileWriter::AddTrack() {
+            if (_Format == MidiFile::Format::SingleTrack && _TrackCount >= 1) {
+                return InvalidTrack;
+            }
+            if (_TrackCount >= 0xFFFF) {
+                return InvalidTrack; // Track count is stored in 16 bits
+            }
+
+            if (_TrackCount == _TrackCapacity) {
+                size_t new_capacity = (_TrackCapacity == 0) ? 4 : _TrackCapacity * 2;
+                _Track* new_tracks = static_cast<_Track*>(realloc(_Tracks, new_capacity * sizeof(_Track)));
+                if (new_tracks == nullptr) {
+                    return InvalidTrack; // Memory allocation failed
+                }
+                _Tracks = new_tracks;
+                _TrackCapacity = new_capacity;
+            }
+
+            _Tracks[_TrackCount] = {nullptr, 0, 0, 0, 0, false};
+            return _TrackCount++;
+        }
+
+        size_t MidiFileWriter::TrackCount() const {
+            return _TrackCount;
+        }
+
+        void MidiFileWriter::Clear() {
+            for (size_t i = 0; i < _TrackCount; i++) {
+                free(_Tracks[i].Data);
+            }
+            _TrackCount = 0;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Events
+
+        bool MidiFileWriter::Event(size_t Track, uint32_t Tick, const uint8_t* Data, size_t Size) {
+            if (Track >= _TrackCount || Data == nullptr || Size == 0 || Data[0] < 0x80) {
+                return false; // Events must start with a status byte
+            }
+
+            uint8_t status = Data[0];
+            _Track& track = _Tracks[Track];
+
+            if (status < MIDI_SYSEX_START) {
+                // Channel Voice: the buffer may hold several messages, later ones under running status as
+                // built by `Message::CC_NRPN`. Check that it ends on a message boundary before writing.
+                uint8_t current = status;
+                for (size_t i = 0; i < Size; ) {
+                    if (Data[i] >= MIDI_SYSEX_START) {
+                        return false;
+                    }
+                    if (Data[i] >= 0x80) {
+                        current = Data[i++];
+                    }
+                    size_t data_size = MidiProtocol::StatusTable[current].Size - 1;
+                    if (Size - i < data_size) {
+                        return false;
+                    }
+                    i += data_size;
+                }
+
+                // One event per message, omitting the status byte when it matches the running status of the track
+                current = status;
+                for (size_t i = 0; i < Size; ) {
+                    if (Data[i] >= 0x80) {
+                        current = Data[i++];
+                    }
+                    size_t data_size = MidiProtocol::StatusTable[current].Size - 1;
+                    size_t skip = (track.RunningStatus == current) ? 1 : 0;
+                    uint8_t* dest = _begin(Track, Tick, data_size + 1 - skip);
+                    if (dest == nullptr) {
+                        return false;
+                    }
+
+                    if (skip == 0) {
+                        *dest++ = current;
+                    }
+                    memcpy(dest, Data + i, data_size);
+                    track.RunningStatus = current;
+                    i += data_size;
+                }
+                return true;
+            }
+
+            // SysEx events carry the bytes after 0xF0, escape events carry the whole message
+            bool sysex = (status == MIDI_SYSEX_START);
+            const uint8_t* payload = sysex ? (Data + 1) : Data;
+            size_t length = sysex ? (Size - 1) : Size;
+            if (length > MidiFile::MaxVariableLength) {
+                return false;
+            }
+
+            size_t header = 1 + MidiFile::VariableLengthSize(static_cast<uint32_t>(length));
+            uint8_t* dest = _begin(Track, Tick, header + length);
+            if (dest == nullptr) {
+                return false;
+            }
+
+            dest[0] = sysex ? MidiFile::SysExEvent : MidiFile::EscapeEvent;
+            MidiFile::WriteVariableLength(dest + 1, static_cast<uint32_t>(length));
+            memcpy(dest + header, payload, length);
+            _Tracks[Track].RunningStatus = 0;
+            return true;
+        }
+
+        bool MidiFileWriter::Event(size_t Track, uint32_t Tick, const Message& Source) {
+            return Event(Track, Tick, Source.Buffer(), Source.size());
+        }
+
+        bool MidiFileWriter::Event(size_t Track, uint32_t Tick, const ShortMessage& Source) {
+            uint8_t buffer[3];
+            size_t size = Source.CopyTo(buffer);
+            return Event(Track, Tick, buffer, size);
+        }
+
+        bool MidiFileWriter::Meta(size_t Track, uint32_t Tick, MidiFile::MetaType Type, const uint8_t* Data, size_t Size) {
+            if ((Data == nullptr && Size > 0) || Size > MidiFile::MaxVariableLength) {
+                return false;
+            }
+
+            size_t header = 2 + MidiFile::VariableLengthSize(static_cast<uint32_t>(Size));
+            uint8_t* dest = _begin(Track, Tick, header + Size);
+            if (dest == nullptr) {
+                return false;
+            }
+
+            dest[0] = MidiFile::MetaEvent;
+            dest[1] = static_cast<uint8_t>(Type);
+            MidiFile::WriteVariableLength(dest + 2, static_cast<uint32_t>(Size));
+            if (Size > 0) {
+                memcpy(dest + header, Data, Size);
+            }
+
+            _Tracks[Track].RunningStatus = 0;
+            if (Type == MidiFile::MetaType::EndOfTrack) {
+                _Tracks[Track].Ended = true;
+            }
+            return true;
+        }
+
+        bool MidiFileWriter::Tempo(size_t Track, uint32_t Tick, uint32_t MicrosecondsPerQuarter) {
+            uint8_t data[3];
+            _writeBigEndian(data, (MicrosecondsPerQuarter < 0xFFFFFF) ? MicrosecondsPerQuarter : 0xFFFFFF, 3);
+            return Meta(Track, Tick, MidiFile::MetaType::Tempo, data, sizeof(data));
+        }
+
+        bool MidiFileWriter::TrackName(size_t Track, const char* Name) {
+            if (Name == nullptr || Track >= _TrackCount) {
+                return false;
+            }
+            return Meta(Track, _Tracks[Track].Tick, MidiFile::MetaType::TrackName, reinterpret_cast<const uint8_t*>(Name), strlen(Name));
+        }
+
+        bool MidiFileWriter::TimeSignature(size_t Track, uint32_t Tick, uint8_t Numerator, uint8_t DenominatorPower,
+                                           uint8_t ClocksPerClick, uint8_t ThirtySecondsPerQuarter) {
+            const uint8_t data[4] = {Numerator, DenominatorPower, ClocksPerClick, ThirtySecondsPerQuarter};
+            return Meta(Track, Tick, MidiFile::MetaType::TimeSignature, data, sizeof(data));
+        }
+
+        bool MidiFileWriter::EndOfTrack(size_t Track, uint32_t Tick) {
+            return Meta(Track, Tick, MidiFile::MetaType::EndOfTrack, nullptr, 0);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Output
+
+        void MidiFileWriter::BindOutput(CallbackType Callback) {
+            _Output.bind(Callback);
+        }
+
+        void MidiFileWriter::UnbindOutput() {
+            _Output.unbind();
+        }
+
+        size_t MidiFileWriter::FileSize() const {
+            size_t size = MidiFile::HeaderSize;
+            for (size_t i = 0; i < _TrackCount; i++) {
+                size += MidiFile::ChunkHeaderSize + _Tracks[i].Size + (_Tracks[i].Ended ? 0 : _endOfTrackSize);
+            }
+            return size;
+        }
+
+        bool MidiFileWriter::Write() {
+            if (!_Output.status()) {
+                return false;
+            }
+            return _write(&MidiFileWriter::_outputSink, this);
+        }
+
+        #if __has_include(<stdio.h>)
+            bool MidiFileWriter::WriteFile(const char* Path) {
+                FILE* file = fopen(Path, "wb");
+                if (file == nullptr) {
+                    return false;
+                }
+
+                // Each track body goes out in a single fwrite, so stdio buffering only applies to the chunk headers
+                bool ok = _write(&_fileSink, file);
+                ok = !ferror(file) && ok;
+                return (fclose(file) == 0) && ok;
+            }
+        #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,195 @@
+#ifndef MIDILAR_MIDI_FILE_WRITER_H
+#define MIDILAR_MIDI_FILE_WRITER_H
+
+/**
+ * @file MidiFileWriter.h
+ * @brief Provides the `MidiFileWriter` class for recording MIDI events into a Standard MIDI File.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #if __has_include(<stdio.h>)
+        #include <stdio.h>
+    #endif
+
+    #include <SystemCore/CallbackHandler/CallbackHandler.h>
+    #include <MidiCore/Protocol/Defines.h>
+    #include <MidiCore/Protocol/StatusTable.h>
+    #include <MidiCore/Message/Message.h>
+    #include <MidiCore/Message/ShortMessage.h>
+    #include <MidiCore/MidiFile/MidiFileFormat.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class MidiFileWriter
+         * @brief Records timestamped MIDI events into a type 0 or type 1 Standard MIDI File.
+         *
+         * Events are added per track with an absolute time in ticks. Each track is encoded on the fly
+         * into its own growable buffer: the delta time is written as a variable-length quantity, and
+         * Channel Voice messages drop their status byte whenever running status allows it. System
+         * Exclusive messages are stored as SysEx events; other system messages (real-time, system
+         * common) are stored as escape (0xF7) events. SysEx, escape and meta events cancel running
+         * status, as required by the format.
+         *
+         * Track lengths are known when the file is written, so the output is produced in a single
+         * pass of large writes: one per chunk header and one per track body.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * MidiFileWriter writer(MidiFile::Format::MultiTrack, 480);
+         * size_t tempo = writer.AddTrack();
+         * size_t piano = writer.AddTrack();
+         *
+         * writer.Tempo(tempo, 0, 500000);
+         * writer.TimeSignature(tempo, 0, 4, 2);
+         * writer.Event(piano, 0, ShortMessage::NoteOn(60, 100));
+         * writer.Event(piano, 480, ShortMessage::NoteOff(60));
+         *
+         * writer.WriteFile("capture.mid");
+         * ```
+         *
+         * @note Events added with a time earlier than the last event of their track are written with a
+         *       delta time of 0.
+         */
+            class MidiFileWriter {
+
+            public:
+                using CallbackType = MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t>::CallbackType; ///< Output callback type.
+
+                static constexpr size_t InvalidTrack = SIZE_MAX;    ///< Returned by `AddTrack()` when no track can be added.
+
+            private:
+                struct _Track {
+                    uint8_t* Data;          ///< Encoded track body.
+                    size_t Size;            ///< Bytes in use.
+                    size_t Capacity;        ///< Allocated size of `Data`.
+                    uint32_t Tick;          ///< Absolute time of the last event.
+                    uint8_t RunningStatus;  ///< Status byte in effect, 0 when none.
+                    bool Ended;             ///< True once the End of Track meta event is written.
+                };
+
+                MIDILAR::SystemCore::CallbackHandler<void, const uint8_t*, size_t> _Output; ///< Receives the file bytes.
+                _Track* _Tracks;
+                size_t _TrackCount;
+                size_t _TrackCapacity;
+                MidiFile::Format _Format;
+                uint16_t _Division;
+
+                uint8_t* _begin(size_t Track, uint32_t Tick, size_t Size); ///< Writes the delta time and reserves `Size` more bytes.
+                bool _write(void (*Sink)(void*, const uint8_t*, size_t), void* Context); ///< Ends open tracks and passes the file to `Sink`.
+                static void _outputSink(void* Context, const uint8_t* Data, size_t Size);
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Construction and Tracks
+                * @{
+                */
+                    /**
+                     * @brief Constructs an empty file.
+                     * @param FileFormat Type 0 files hold a single track.
+                     * @param Division Ticks per quarter note.
+                     */
+                    MidiFileWriter(MidiFile::Format FileFormat = MidiFile::Format::MultiTrack, uint16_t Division = 480);
+                    ~MidiFileWriter();
+
+                    MidiFileWriter(const MidiFileWriter&) = delete;
+                    MidiFileWriter& operator=(const MidiFileWriter&) = delete;
+
+                    /**
+                     * @brief Adds an empty track.
+                     * @return Index of the new track, or `InvalidTrack` if the format allows no more tracks or allocation failed.
+                     */
+                    size_t AddTrack();
+
+                    size_t TrackCount() const;  ///< Returns the number of tracks.
+                    void Clear();               ///< Removes every track, keeping the file format and division.
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Events
+                * @brief Each function adds one event at the absolute time `Tick` and returns false if the
+                * track does not exist, is already ended, the event is invalid or allocation failed.
+                * @{
+                */
+                    /**
+                     * @brief Adds a complete MIDI message.
+                     *
+                     * A Channel Voice buffer may hold several messages, later ones under running status, as
+                     * built by `Message::CC_NRPN`. Each one becomes its own event, and nothing is written
+                     * unless the buffer ends on a message boundary.
+                     */
+                    bool Event(size_t Track, uint32_t Tick, const uint8_t* Data, size_t Size);
+                    bool Event(size_t Track, uint32_t Tick, const Message& Source);
+                    bool Event(size_t Track, uint32_t Tick, const ShortMessage& Source);
+
+                    bool Meta(size_t Track, uint32_t Tick, MidiFile::MetaType Type, const uint8_t* Data, size_t Size); ///< Adds a meta event.
+                    bool Tempo(size_t Track, uint32_t Tick, uint32_t MicrosecondsPerQuarter);                          ///< Adds a tempo change.
+                    bool TrackName(size_t Track, const char* Name);                                                    ///< Adds a track name at the time of the last event; call it before any event to place it at time 0.
+
+                    /**
+                     * @brief Adds a time signature.
+                     * @param Numerator Beats per bar.
+                     * @param DenominatorPower Beat unit as a power of two (2 for a quarter note).
+                     * @param ClocksPerClick MIDI clocks per metronome click.
+                     * @param ThirtySecondsPerQuarter Notated 32nd notes per quarter note.
+                     */
+                    bool TimeSignature(size_t Track, uint32_t Tick, uint8_t Numerator, uint8_t DenominatorPower,
+                                       uint8_t ClocksPerClick = 24, uint8_t ThirtySecondsPerQuarter = 8);
+
+                    /**
+                     * @brief Ends a track. Tracks left open are ended at their last event when the file is written.
+                     */
+                    bool EndOfTrack(size_t Track, uint32_t Tick);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Output
+                * @{
+                */
+                    void BindOutput(CallbackType Callback); ///< Binds a standalone output callback.
+
+                    /**
+                     * @brief Binds an instance method as output callback.
+                     * @tparam T Class type of the instance.
+                     * @tparam Method Member function to bind.
+                     * @param instance Pointer to the instance that owns the method.
+                     */
+                    template <typename T, void (T::*Method)(const uint8_t*, size_t)>
+                    inline void BindOutput(T* instance) {
+                        _Output.bind<T, Method>(instance);
+                    }
+
+                    void UnbindOutput(); ///< Unbinds the output callback.
+
+                    size_t FileSize() const; ///< Returns the size of the complete file, including End of Track events still to be added.
+
+                    /**
+                     * @brief Ends every open track and sends the complete file to the output callback.
+                     * @return False if no output callback is bound.
+                     */
+                    bool Write();
+
+                    #if __has_include(<stdio.h>)
+                        /**
+                         * @brief Ends every open track and writes the complete file to disk.
+                         * @return False if the file cannot be opened or written.
+                         */
+                        bool WriteFile(const char* Path);
+                    #endif
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_FILE_WRITER_H
@@ -30,6 +30,26 @@
 					#define MIDI_SYSEX_SAMPLE_DUMP_HEADER  0x01
 					#define MIDI_SYSEX_SAMPLE_DATA_PACKET  0x02
 					#define MIDI_SYSEX_SAMPLE_DUMP_REQUEST 0x03
+
+				// General Information
+
+					#define MIDI_SYSEX_NRT_GENERAL_INFO     0x06
+					#define MIDI_SYSEX_NRT_IDENTITY_REQUEST 0x01
+					#define MIDI_SYSEX_NRT_IDENTITY_REPLY   0x02
+
+			// Real Time
+
+				#define MIDI_SYSEX_RT 0x7F
+
+				// Sub ID 1 (MIDI Time Code is MIDI_SYSEX_REALTIME_MTC, see Defines_MTC.h)
+
+					#define MIDI_SYSEX_RT_MSC          0x02
+					#define MIDI_SYSEX_RT_MMC_COMMAND  0x06
+					#define MIDI_SYSEX_RT_MMC_RESPONSE 0x07
+
+			// Device ID addressing every device
+
+				#define MIDI_SYSEX_ALL_CALL 0x7F
 			
 		//
 		////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+#include "Scan.h"
+
+#if !defined(MIDILAR_PROTOCOL_SCAN_SCALAR)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define PROTOCOL_SCAN_AVX2
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define PROTOCOL_SCAN_SSE2
+    #endif
+    #if defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        #include <arm_neon.h>
+        #define PROTOCOL_SCAN_NEON
+    #endif
+#endif
+
+namespace MIDILAR::MidiCore::Protocol::Scan {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Bit Helpers
+
+        /**
+         * @brief Returns the index of the lowest set bit of a non-zero value.
+         */
+        [[maybe_unused]] inline size_t _lowestBit(uint64_t Value) {
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<size_t>(__builtin_ctzll(Value));
+            #else
+                size_t index = 0;
+                while ((Value & 1) == 0) {
+                    Value >>= 1;
+                    index++;
+                }
+                return index;
+            #endif
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Portable Implementation
+
+        size_t Scalar::DataRunLength(const uint8_t* Data, size_t Size) {
+            size_t i = 0;
+            while (i < Size && Data[i] < 0x80) {
+                i++;
+            }
+            return i;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Data Runs
+    //
+    // The vector paths test a whole block for set high bits and only locate the byte in the block that has one.
+
+        size_t DataRunLength(const uint8_t* Data, size_t Size) {
+            size_t i = 0;
+
+            #if defined(PROTOCOL_SCAN_AVX2)
+                for (; Size - i >= 32; i += 32) {
+                    uint32_t msb = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + i))));
+                    if (msb != 0) {
+                        return i + _lowestBit(msb);
+                    }
+                }
+            #endif
+
+            #if defined(PROTOCOL_SCAN_SSE2)
+                for (; Size - i >= 16; i += 16) {
+                    uint32_t msb = static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i))));
+                    if (msb != 0) {
+                        return i + _lowestBit(msb);
+                    }
+                }
+            #elif defined(PROTOCOL_SCAN_NEON)
+                for (; Size - i >= 16; i += 16) {
+                    // Keep only the high bit of each byte; lanes are little-endian, so the lowest set bit is the first byte
+                    uint64x2_t msb = vreinterpretq_u64_u8(vshrq_n_u8(vld1q_u8(Data + i), 7));
+                    uint64_t lo = vgetq_lane_u64(msb, 0);
+                    uint64_t hi = vgetq_lane_u64(msb, 1);
+                    if (lo != 0) {
+                        return i + _lowestBit(lo) / 8;
+                    }
+                    if (hi != 0) {
+                        return i + 8 + _lowestBit(hi) / 8;
+                    }
+                }
+            #endif
+
+            return i + Scalar::DataRunLength(Data + i, Size - i);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
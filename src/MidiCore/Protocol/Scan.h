@@ -0,0 +1,43 @@
+#ifndef MIDILAR_MIDI_CORE_PROTOCOL_SCAN_H
+#define MIDILAR_MIDI_CORE_PROTOCOL_SCAN_H
+
+/**
+ * @file Scan.h
+ * @brief Byte stream scanning primitives shared by the parsers.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    /**
+     * @namespace MIDILAR::MidiCore::Protocol::Scan
+     * @brief Functions locating status bytes in a MIDI 1.0 byte stream several bytes at a time.
+     *
+     * The default functions use SSE2, AVX2 or NEON when the compiler targets them, and fall back
+     * to the portable implementation otherwise. Defining `MIDILAR_PROTOCOL_SCAN_SCALAR` forces the
+     * portable implementation. The `Scalar` namespace always exposes the portable version.
+     */
+    namespace MIDILAR::MidiCore::Protocol::Scan {
+
+            /**
+             * @brief Counts the data bytes (high bit clear) at the start of a buffer.
+             *
+             * Finds the next status byte in a stream: the end of a SysEx payload, or of a run of data
+             * bytes under running status.
+             * @param Data Input bytes.
+             * @param Size Number of input bytes.
+             * @return Index of the first byte with its high bit set, or `Size` if there is none.
+             */
+            size_t DataRunLength(const uint8_t* Data, size_t Size);
+
+            /**
+             * @namespace MIDILAR::MidiCore::Protocol::Scan::Scalar
+             * @brief Portable byte-by-byte versions of the scanning functions, with identical results.
+             */
+            namespace Scalar {
+                size_t DataRunLength(const uint8_t* Data, size_t Size);
+            }
+    }
+
+#endif//MIDILAR_MIDI_CORE_PROTOCOL_SCAN_H
@@ -0,0 +1,116 @@
+#ifndef MIDILAR_MIDI_CORE_PROTOCOL_STATUS_TABLE_H
+#define MIDILAR_MIDI_CORE_PROTOCOL_STATUS_TABLE_H
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include "Defines.h"
+
+    namespace MIDILAR::MidiCore::Protocol {
+
+        /**
+         * @brief Message kind identified by a status byte.
+         */
+        enum class MessageKind : uint8_t {
+            Data = 0,               ///< Not a status byte (0x00-0x7F).
+            NoteOff,
+            NoteOn,
+            AfterTouch,
+            ControlChange,
+            ProgramChange,
+            ChannelPressure,
+            PitchBend,
+            SysExStart,
+            MTCQuarterFrame,
+            SongPositionPointer,
+            SongSelect,
+            TuningRequest,
+            SysExEnd,
+            TimingTick,
+            Start,
+            Continue,
+            Stop,
+            ActiveSensing,
+            SystemReset,
+            Undefined               ///< Reserved status bytes (0xF4, 0xF5, 0xF9, 0xFD).
+        };
+
+        /**
+         * @brief Message category identified by a status byte.
+         */
+        enum class MessageCategory : uint8_t {
+            None = 0,               ///< Data bytes and undefined status bytes.
+            ChannelVoice,
+            SystemCommon,
+            SystemExclusive,
+            RealTime
+        };
+
+        /**
+         * @brief Classification of a single status byte.
+         */
+        struct StatusInfo {
+            MessageKind Kind;
+            MessageCategory Category;
+            uint8_t Size;           ///< Complete message size in bytes, 0 for variable length or invalid.
+        };
+
+        /**
+         * @brief Classifies a status byte. Used to build `StatusTable`.
+         */
+        constexpr StatusInfo ClassifyStatus(uint8_t Status) {
+            if (Status < 0x80) {
+                return {MessageKind::Data, MessageCategory::None, 0};
+            }
+
+            switch (Status & 0xF0) {
+                case MIDI_NOTE_OFF:         return {MessageKind::NoteOff, MessageCategory::ChannelVoice, 3};
+                case MIDI_NOTE_ON:          return {MessageKind::NoteOn, MessageCategory::ChannelVoice, 3};
+                case MIDI_AFTER_TOUCH:      return {MessageKind::AfterTouch, MessageCategory::ChannelVoice, 3};
+                case MIDI_CONTROL_CHANGE:   return {MessageKind::ControlChange, MessageCategory::ChannelVoice, 3};
+                case MIDI_PROGRAM_CHANGE:   return {MessageKind::ProgramChange, MessageCategory::ChannelVoice, 2};
+                case MIDI_CHANNEL_PRESSURE: return {MessageKind::ChannelPressure, MessageCategory::ChannelVoice, 2};
+                case MIDI_PITCH_BEND:       return {MessageKind::PitchBend, MessageCategory::ChannelVoice, 3};
+                default: break;
+            }
+
+            switch (Status) {
+                case MIDI_SYSEX_START:              return {MessageKind::SysExStart, MessageCategory::SystemExclusive, 0};
+                case MIDI_MTC_QUARTER_FRAME:        return {MessageKind::MTCQuarterFrame, MessageCategory::SystemCommon, 2};
+                case MIDI_SONG_POSITION_POINTER:    return {MessageKind::SongPositionPointer, MessageCategory::SystemCommon, 3};
+                case MIDI_SONG_SELECT:              return {MessageKind::SongSelect, MessageCategory::SystemCommon, 2};
+                case MIDI_TUNING_REQUEST:           return {MessageKind::TuningRequest, MessageCategory::SystemCommon, 1};
+                case MIDI_SYSEX_END:                return {MessageKind::SysExEnd, MessageCategory::SystemExclusive, 0};
+                case MIDI_REALTIME_TIMING_TICK:     return {MessageKind::TimingTick, MessageCategory::RealTime, 1};
+                case MIDI_REALTIME_START:           return {MessageKind::Start, MessageCategory::RealTime, 1};
+                case MIDI_REALTIME_CONTINUE:        return {MessageKind::Continue, MessageCategory::RealTime, 1};
+                case MIDI_REALTIME_STOP:            return {MessageKind::Stop, MessageCategory::RealTime, 1};
+                case MIDI_REALTIME_ACTIVE_SENSING:  return {MessageKind::ActiveSensing, MessageCategory::RealTime, 1};
+                case MIDI_REALTIME_SYSTEM_RESET:    return {MessageKind::SystemReset, MessageCategory::RealTime, 1};
+                default:                            return {MessageKind::Undefined, MessageCategory::None, 0};
+            }
+        }
+
+        /**
+         * @brief 256-entry lookup table holding the `StatusInfo` of every byte value.
+         */
+        struct StatusInfoTable {
+            StatusInfo Entries[256];
+
+            constexpr const StatusInfo& operator[](uint8_t Status) const { return Entries[Status]; }
+        };
+
+        /**
+         * @brief Builds the status lookup table at compile time.
+         */
+        constexpr StatusInfoTable BuildStatusTable() {
+            StatusInfoTable table{};
+            for (unsigned int i = 0; i < 256; i++) {
+                table.Entries[i] = ClassifyStatus(static_cast<uint8_t>(i));
+            }
+            return table;
+        }
+
+        inline constexpr StatusInfoTable StatusTable = BuildStatusTable(); ///< Status classification for every byte value.
+    }
+
+#endif//MIDILAR_MIDI_CORE_PROTOCOL_STATUS_TABLE_H
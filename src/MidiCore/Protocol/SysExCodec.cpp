@@ -0,0 +1,335 @@
+#include "SysExCodec.h"
+
+#include <string.h>
+
+#if !defined(MIDILAR_SYSEX_CODEC_SCALAR)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define SYSEX_CODEC_AVX2
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define SYSEX_CODEC_SSE2
+    #endif
+    #if defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        #include <arm_neon.h>
+        #define SYSEX_CODEC_NEON
+    #endif
+#endif
+
+namespace MIDILAR::MidiCore::Protocol::SysExCodec {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Bit Helpers
+
+        /**
+         * @brief Moves bits 0-6 of `Header` to bit 0 of bytes 0-6.
+         *
+         * Bit `n` lands at position `7 * n + n`; the multiplication produces no carries because every
+         * partial product sets a different bit.
+         */
+        [[maybe_unused]] inline uint64_t _spreadHeader(uint8_t Header) {
+            return (static_cast<uint64_t>(Header & 0x7F) * 0x0002040810204081ULL) & 0x0001010101010101ULL;
+        }
+
+        /**
+         * @brief Gathers the MSB of bytes 0-6 of a little-endian word into bits 0-6. Inverse of `_spreadHeader()`.
+         */
+        [[maybe_unused]] inline uint8_t _gatherHeader(uint64_t Word) {
+            return static_cast<uint8_t>((((Word >> 7) & 0x0001010101010101ULL) * 0x0102040810204080ULL) >> 56);
+        }
+
+        [[maybe_unused]] inline uint64_t _load64(const uint8_t* Data) {
+            uint64_t word;
+            memcpy(&word, Data, sizeof(word));
+            return word;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Portable Implementation
+
+        size_t Scalar::Pack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out) {
+            size_t index = 0;
+
+            for (size_t i = 0; i < Size; i += 7) {
+                size_t count = (Size - i < 7) ? (Size - i) : 7;
+                uint8_t header = 0;
+
+                for (size_t k = 0; k < count; k++) {
+                    header |= static_cast<uint8_t>((Data[i + k] >> 7) << k);
+                    Out[index + 1 + k] = Data[i + k] & 0x7F;
+                }
+
+                Out[index] = header;
+                index += count + 1;
+            }
+            return index;
+        }
+
+        size_t Scalar::Unpack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out) {
+            size_t index = 0;
+
+            for (size_t i = 0; i + 1 < Size; i += 8) {
+                size_t count = (Size - i < 8) ? (Size - i - 1) : 7;
+                uint8_t header = Data[i];
+
+                for (size_t k = 0; k < count; k++) {
+                    Out[index++] = static_cast<uint8_t>((Data[i + 1 + k] & 0x7F) | (((header >> k) & 0x01) << 7));
+                }
+            }
+            return index;
+        }
+
+        size_t Scalar::Nibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst) {
+            for (size_t i = 0; i < Size; i++) {
+                uint8_t high = Data[i] >> 4;
+                uint8_t low = Data[i] & 0x0F;
+                Out[2 * i] = LowNibbleFirst ? low : high;
+                Out[2 * i + 1] = LowNibbleFirst ? high : low;
+            }
+            return Size * 2;
+        }
+
+        size_t Scalar::Denibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst) {
+            size_t count = Size / 2;
+
+            for (size_t i = 0; i < count; i++) {
+                uint8_t first = Data[2 * i] & 0x0F;
+                uint8_t second = Data[2 * i + 1] & 0x0F;
+                Out[i] = LowNibbleFirst ? static_cast<uint8_t>((second << 4) | first)
+                                        : static_cast<uint8_t>((first << 4) | second);
+            }
+            return count;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // 7-in-8 Packing
+    //
+    // The vector paths handle several whole groups per iteration and leave the remainder to the portable
+    // implementation. Each 7-byte group is loaded into its own 64-bit lane, so a left shift by one byte
+    // makes room for the header, and a right shift by one byte drops it again when unpacking.
+
+        size_t Pack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out) {
+            size_t i = 0;
+            size_t index = 0;
+
+            #if defined(SYSEX_CODEC_AVX2)
+                const __m256i mask7_256 = _mm256_set1_epi8(0x7F);
+
+                // Four groups per iteration; the last load reads one byte past the fourth group.
+                for (; Size - i >= 29; i += 28, index += 32) {
+                    __m128i lo = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i)),
+                                                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i + 7)));
+                    __m128i hi = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i + 14)),
+                                                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i + 21)));
+                    __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+                    uint32_t msb = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+                    __m256i headers = _mm256_set_epi64x((msb >> 24) & 0x7F, (msb >> 16) & 0x7F, (msb >> 8) & 0x7F, msb & 0x7F);
+
+                    __m256i r = _mm256_or_si256(_mm256_slli_epi64(_mm256_and_si256(v, mask7_256), 8), headers);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + index), r);
+                }
+            #endif
+
+            #if defined(SYSEX_CODEC_SSE2)
+                const __m128i mask7 = _mm_set1_epi8(0x7F);
+
+                // Two groups per iteration; the second load reads one byte past the second group.
+                for (; Size - i >= 15; i += 14, index += 16) {
+                    __m128i v = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i)),
+                                                   _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data + i + 7)));
+
+                    uint32_t msb = static_cast<uint32_t>(_mm_movemask_epi8(v));
+                    __m128i headers = _mm_set_epi64x((msb >> 8) & 0x7F, msb & 0x7F);
+
+                    __m128i r = _mm_or_si128(_mm_slli_epi64(_mm_and_si128(v, mask7), 8), headers);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + index), r);
+                }
+            #elif defined(SYSEX_CODEC_NEON)
+                const uint8x16_t mask7 = vdupq_n_u8(0x7F);
+
+                for (; Size - i >= 15; i += 14, index += 16) {
+                    uint8x16_t v = vcombine_u8(vld1_u8(Data + i), vld1_u8(Data + i + 7));
+                    uint64x2_t headers = vcombine_u64(vcreate_u64(_gatherHeader(_load64(Data + i))),
+                                                      vcreate_u64(_gatherHeader(_load64(Data + i + 7))));
+
+                    uint64x2_t r = vorrq_u64(vshlq_n_u64(vreinterpretq_u64_u8(vandq_u8(v, mask7)), 8), headers);
+                    vst1q_u8(Out + index, vreinterpretq_u8_u64(r));
+                }
+            #endif
+
+            return index + Scalar::Pack7Bit(Data + i, Size - i, Out + index);
+        }
+
+        size_t Unpack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out) {
+            size_t i = 0;
+            size_t index = 0;
+
+            // Each iteration writes one byte past its output. The loop conditions keep at least one more
+            // group of input, so the extra byte is always overwritten by a later write.
+
+            #if defined(SYSEX_CODEC_AVX2)
+                const __m256i mask7_256 = _mm256_set1_epi8(0x7F);
+
+                for (; Size - i >= 34; i += 32, index += 28) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + i));
+                    __m256i msb = _mm256_set_epi64x(_spreadHeader(Data[i + 24]), _spreadHeader(Data[i + 16]),
+                                                    _spreadHeader(Data[i + 8]), _spreadHeader(Data[i]));
+
+                    __m256i r = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi64(v, 8), mask7_256), _mm256_slli_epi64(msb, 7));
+                    __m128i lo = _mm256_castsi256_si128(r);
+                    __m128i hi = _mm256_extracti128_si256(r, 1);
+
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index), lo);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index + 7), _mm_unpackhi_epi64(lo, lo));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index + 14), hi);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index + 21), _mm_unpackhi_epi64(hi, hi));
+                }
+            #endif
+
+            #if defined(SYSEX_CODEC_SSE2)
+                const __m128i mask7 = _mm_set1_epi8(0x7F);
+
+                for (; Size - i >= 18; i += 16, index += 14) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+                    __m128i msb = _mm_set_epi64x(_spreadHeader(Data[i + 8]), _spreadHeader(Data[i]));
+
+                    __m128i r = _mm_or_si128(_mm_and_si128(_mm_srli_epi64(v, 8), mask7), _mm_slli_epi64(msb, 7));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index), r);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(Out + index + 7), _mm_unpackhi_epi64(r, r));
+                }
+            #elif defined(SYSEX_CODEC_NEON)
+                const uint8x16_t mask7 = vdupq_n_u8(0x7F);
+
+                for (; Size - i >= 18; i += 16, index += 14) {
+                    uint64x2_t v = vreinterpretq_u64_u8(vld1q_u8(Data + i));
+                    uint64x2_t msb = vcombine_u64(vcreate_u64(_spreadHeader(Data[i])), vcreate_u64(_spreadHeader(Data[i + 8])));
+
+                    uint8x16_t r = vorrq_u8(vandq_u8(vreinterpretq_u8_u64(vshrq_n_u64(v, 8)), mask7),
+                                            vreinterpretq_u8_u64(vshlq_n_u64(msb, 7)));
+                    vst1_u8(Out + index, vget_low_u8(r));
+                    vst1_u8(Out + index + 7, vget_high_u8(r));
+                }
+            #endif
+
+            return index + Scalar::Unpack7Bit(Data + i, Size - i, Out + index);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Nibblization
+
+        size_t Nibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst) {
+            size_t i = 0;
+
+            #if defined(SYSEX_CODEC_AVX2)
+                const __m256i mask4_256 = _mm256_set1_epi8(0x0F);
+
+                for (; Size - i >= 32; i += 32) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + i));
+                    __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask4_256);
+                    __m256i low = _mm256_and_si256(v, mask4_256);
+                    __m256i first = LowNibbleFirst ? low : high;
+                    __m256i second = LowNibbleFirst ? high : low;
+
+                    // Byte unpacking works per 128-bit lane; put the lanes back in order before storing.
+                    __m256i a = _mm256_unpacklo_epi8(first, second);
+                    __m256i b = _mm256_unpackhi_epi8(first, second);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+                }
+            #endif
+
+            #if defined(SYSEX_CODEC_SSE2)
+                const __m128i mask4 = _mm_set1_epi8(0x0F);
+
+                for (; Size - i >= 16; i += 16) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+                    __m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), mask4);
+                    __m128i low = _mm_and_si128(v, mask4);
+                    __m128i first = LowNibbleFirst ? low : high;
+                    __m128i second = LowNibbleFirst ? high : low;
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 2 * i), _mm_unpacklo_epi8(first, second));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 2 * i + 16), _mm_unpackhi_epi8(first, second));
+                }
+            #elif defined(SYSEX_CODEC_NEON)
+                const uint8x16_t mask4 = vdupq_n_u8(0x0F);
+
+                for (; Size - i >= 16; i += 16) {
+                    uint8x16_t v = vld1q_u8(Data + i);
+                    uint8x16_t high = vshrq_n_u8(v, 4);
+                    uint8x16_t low = vandq_u8(v, mask4);
+
+                    uint8x16x2_t pairs;
+                    pairs.val[0] = LowNibbleFirst ? low : high;
+                    pairs.val[1] = LowNibbleFirst ? high : low;
+                    vst2q_u8(Out + 2 * i, pairs);
+                }
+            #endif
+
+            return 2 * i + Scalar::Nibblize(Data + i, Size - i, Out + 2 * i, LowNibbleFirst);
+        }
+
+        size_t Denibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst) {
+            size_t i = 0;
+            size_t count = Size / 2;
+
+            // Each pair of input bytes is handled as one little-endian 16-bit word: the first byte is the low half.
+
+            #if defined(SYSEX_CODEC_AVX2)
+                const __m256i mask4_256 = _mm256_set1_epi16(0x000F);
+
+                for (; count - i >= 32; i += 32) {
+                    __m256i r[2];
+                    for (size_t k = 0; k < 2; k++) {
+                        __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + 2 * i + 32 * k));
+                        __m256i first = _mm256_and_si256(w, mask4_256);
+                        __m256i second = _mm256_and_si256(_mm256_srli_epi16(w, 8), mask4_256);
+                        r[k] = LowNibbleFirst ? _mm256_or_si256(_mm256_slli_epi16(second, 4), first)
+                                              : _mm256_or_si256(_mm256_slli_epi16(first, 4), second);
+                    }
+
+                    // Packing works per 128-bit lane; restore the 64-bit quarters to source order.
+                    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(r[0], r[1]), 0xD8);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), packed);
+                }
+            #endif
+
+            #if defined(SYSEX_CODEC_SSE2)
+                const __m128i mask4 = _mm_set1_epi16(0x000F);
+
+                for (; count - i >= 16; i += 16) {
+                    __m128i r[2];
+                    for (size_t k = 0; k < 2; k++) {
+                        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 2 * i + 16 * k));
+                        __m128i first = _mm_and_si128(w, mask4);
+                        __m128i second = _mm_and_si128(_mm_srli_epi16(w, 8), mask4);
+                        r[k] = LowNibbleFirst ? _mm_or_si128(_mm_slli_epi16(second, 4), first)
+                                              : _mm_or_si128(_mm_slli_epi16(first, 4), second);
+                    }
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packus_epi16(r[0], r[1]));
+                }
+            #elif defined(SYSEX_CODEC_NEON)
+                const uint8x16_t mask4 = vdupq_n_u8(0x0F);
+
+                for (; count - i >= 16; i += 16) {
+                    uint8x16x2_t pairs = vld2q_u8(Data + 2 * i);
+                    uint8x16_t first = vandq_u8(pairs.val[0], mask4);
+                    uint8x16_t second = vandq_u8(pairs.val[1], mask4);
+
+                    vst1q_u8(Out + i, LowNibbleFirst ? vorrq_u8(vshlq_n_u8(second, 4), first)
+                                                     : vorrq_u8(vshlq_n_u8(first, 4), second));
+                }
+            #endif
+
+            return i + Scalar::Denibblize(Data + 2 * i, Size - 2 * i, Out + i, LowNibbleFirst);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,138 @@
+#ifndef MIDILAR_MIDI_CORE_PROTOCOL_SYSEX_CODEC_H
+#define MIDILAR_MIDI_CORE_PROTOCOL_SYSEX_CODEC_H
+
+/**
+ * @file SysExCodec.h
+ * @brief Bulk encoders and decoders for carrying 8-bit data inside System Exclusive messages.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+    #include "Scan.h"
+
+    /**
+     * @namespace MIDILAR::MidiCore::Protocol::SysExCodec
+     * @brief Codecs converting 8-bit data to and from 7-bit SysEx data bytes.
+     *
+     * Two schemes are provided:
+     *
+     * - **7-in-8 packing** ("MSB byte first"): every group of up to 7 data bytes is preceded by
+     *   one byte holding their most significant bits, bit `n` belonging to the `n`-th byte of
+     *   the group. 7 bytes become 8, and a trailing group of `k` bytes becomes `k + 1`.
+     * - **Nibblization**: every byte is split into two bytes carrying 4 bits each, high nibble
+     *   first unless `LowNibbleFirst` is set.
+     *
+     * All functions operate on caller-supplied buffers, never allocate and return the number of
+     * bytes written. The output buffer must hold at least the size given by the matching
+     * `*Size()` function. Input and output must not overlap.
+     *
+     * The end of a payload inside a stream, its first status byte, is found with
+     * `Protocol::Scan::DataRunLength()`.
+     *
+     * The default functions use SSE2, AVX2 or NEON when the compiler targets them, and fall back
+     * to the portable implementation otherwise. Defining `MIDILAR_SYSEX_CODEC_SCALAR` forces the
+     * portable implementation. The `Scalar` namespace always exposes the portable version.
+     *
+     * ## Example Usage:
+     * ```cpp
+     * uint8_t packed[SysExCodec::Pack7BitSize(sizeof(patch))];
+     * size_t size = SysExCodec::Pack7Bit(patch, sizeof(patch), packed);
+     * ```
+     */
+    namespace MIDILAR::MidiCore::Protocol::SysExCodec {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sizes
+
+            /**
+             * @brief Returns the packed size of `Size` raw bytes.
+             */
+            constexpr size_t Pack7BitSize(size_t Size) {
+                return Size + (Size + 6) / 7;
+            }
+
+            /**
+             * @brief Returns the raw size of `Size` packed bytes.
+             *
+             * A trailing packed group holding only its MSB byte carries no data.
+             */
+            constexpr size_t Unpack7BitSize(size_t Size) {
+                return (Size / 8) * 7 + ((Size % 8) ? (Size % 8) - 1 : 0);
+            }
+
+            /**
+             * @brief Returns the nibblized size of `Size` raw bytes.
+             */
+            constexpr size_t NibblizeSize(size_t Size) {
+                return Size * 2;
+            }
+
+            /**
+             * @brief Returns the raw size of `Size` nibblized bytes. An odd trailing byte is ignored.
+             */
+            constexpr size_t DenibblizeSize(size_t Size) {
+                return Size / 2;
+            }
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Codecs
+
+            /**
+             * @brief Packs 8-bit data into 7-bit groups.
+             * @param Data Raw input bytes.
+             * @param Size Number of input bytes.
+             * @param Out Destination, at least `Pack7BitSize(Size)` bytes.
+             * @return Number of bytes written.
+             */
+            size_t Pack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out);
+
+            /**
+             * @brief Unpacks 7-bit groups written by `Pack7Bit()`.
+             * @param Data Packed input bytes.
+             * @param Size Number of input bytes.
+             * @param Out Destination, at least `Unpack7BitSize(Size)` bytes.
+             * @return Number of bytes written.
+             */
+            size_t Unpack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out);
+
+            /**
+             * @brief Splits every byte into two 4-bit data bytes.
+             * @param Data Raw input bytes.
+             * @param Size Number of input bytes.
+             * @param Out Destination, at least `NibblizeSize(Size)` bytes.
+             * @param LowNibbleFirst When true, the low nibble is written before the high nibble.
+             * @return Number of bytes written.
+             */
+            size_t Nibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst = false);
+
+            /**
+             * @brief Joins pairs of 4-bit data bytes written by `Nibblize()`.
+             *
+             * Bits above the low nibble of each input byte are ignored.
+             * @param Data Nibblized input bytes.
+             * @param Size Number of input bytes.
+             * @param Out Destination, at least `DenibblizeSize(Size)` bytes.
+             * @param LowNibbleFirst Must match the order used when nibblizing.
+             * @return Number of bytes written.
+             */
+            size_t Denibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst = false);
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Portable Implementation
+
+            /**
+             * @namespace MIDILAR::MidiCore::Protocol::SysExCodec::Scalar
+             * @brief Portable byte-by-byte versions of the codecs, with identical results.
+             */
+            namespace Scalar {
+                size_t Pack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out);
+                size_t Unpack7Bit(const uint8_t* Data, size_t Size, uint8_t* Out);
+                size_t Nibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst = false);
+                size_t Denibblize(const uint8_t* Data, size_t Size, uint8_t* Out, bool LowNibbleFirst = false);
+            }
+        //
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+#endif//MIDILAR_MIDI_CORE_PROTOCOL_SYSEX_CODEC_H
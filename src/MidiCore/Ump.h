@@ -0,0 +1,12 @@
+#ifndef MIDILAR_MIDI_UMP_H
+#define MIDILAR_MIDI_UMP_H
+
+    #include <MIDILAR_BuildSettings.h>
+    
+    #if __has_include(<MidiCore/Ump/UmpMessage.h>)
+        #define MIDILAR_MIDI_UMP
+        #include <MidiCore/Ump/UmpMessage.h>
+        #include <MidiCore/Ump/UmpTranslator.h>
+    #endif
+
+#endif//MIDILAR_MIDI_UMP_H
\ No newline at end of file
@@ -0,0 +1,220 @@
+#ifndef MIDILAR_MIDI_UMP_MESSAGE_H
+#define MIDILAR_MIDI_UMP_MESSAGE_H
+
+/**
+ * @file UmpMessage.h
+ * @brief Provides the `UmpMessage` value type for MIDI 2.0 Universal MIDI Packets.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <MidiCore/Protocol/StatusTable.h>
+    #include <MidiCore/Message/ShortMessage.h>
+
+    namespace MIDILAR::MidiCore{
+
+        /**
+         * @brief Message Type of a Universal MIDI Packet, stored in the top 4 bits of its first word.
+         */
+        enum class UmpType : uint8_t {
+            Utility             = 0x0,  /**< NOOP and Jitter Reduction timestamps, 32 bits. */
+            System              = 0x1,  /**< System Common and Real-Time messages, 32 bits. */
+            Midi1ChannelVoice   = 0x2,  /**< MIDI 1.0 Channel Voice messages, 32 bits. */
+            Data64              = 0x3,  /**< SysEx7 data packets, 64 bits. */
+            Midi2ChannelVoice   = 0x4,  /**< MIDI 2.0 Channel Voice messages, 64 bits. */
+            Data128             = 0x5,  /**< SysEx8 and Mixed Data Set packets, 128 bits. */
+            FlexData            = 0xD,  /**< Flex Data messages, 128 bits. */
+            Stream              = 0xF   /**< UMP Stream messages, 128 bits. */
+        };
+
+        /**
+         * @brief Position of a SysEx7 packet within its message, stored in bits 20-23 of its first word.
+         */
+        enum class UmpSysExStatus : uint8_t {
+            Complete    = 0x0,  /**< Whole message in one packet. */
+            Start       = 0x1,  /**< First packet of a message. */
+            Continue    = 0x2,  /**< Intermediate packet. */
+            End         = 0x3   /**< Last packet of a message. */
+        };
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class UmpMessage
+         * @brief Trivially copyable Universal MIDI Packet of one to four 32-bit words.
+         *
+         * `UmpMessage` is the MIDI 2.0 counterpart of `ShortMessage`: a fixed-size value holding one
+         * packet, meant to be passed by value through queues and arrays. The size of a packet is set
+         * by its Message Type; the words beyond it are zero.
+         *
+         * Bulk conversion between byte streams and word arrays is done by `UmpTranslator`, which
+         * works directly on `uint32_t` arrays; `UmpMessage` is the convenient view of one packet.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * constexpr UmpMessage note = UmpMessage::FromShortMessage(ShortMessage::NoteOn(60, 100), 2);
+         * static_assert(note.Word(0) == 0x22903C64);
+         * ShortMessage back = note.ToShortMessage();
+         * ```
+         *
+         * @see MIDILAR::MidiCore::UmpTranslator
+         */
+            class UmpMessage {
+
+            private:
+                uint32_t _Words[4]; ///< Packet words, most significant byte first within each word.
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Constructors and Conversions
+                * @{
+                */
+                    constexpr UmpMessage() noexcept : _Words{0, 0, 0, 0} {} ///< Constructs a NOOP packet.
+
+                    /**
+                     * @brief Constructs a packet from its words. Words beyond the packet size are cleared.
+                     */
+                    constexpr UmpMessage(uint32_t Word0, uint32_t Word1 = 0, uint32_t Word2 = 0, uint32_t Word3 = 0) noexcept
+                        : _Words{Word0,
+                                 (WordCount(Word0) > 1) ? Word1 : 0,
+                                 (WordCount(Word0) > 2) ? Word2 : 0,
+                                 (WordCount(Word0) > 3) ? Word3 : 0} {}
+
+                    /**
+                     * @brief Reads one packet from a word array.
+                     * @param Words Array starting with the first word of a packet, holding `WordCount(Words[0])` words.
+                     */
+                    static constexpr UmpMessage FromWords(const uint32_t* Words) noexcept {
+                        size_t count = WordCount(Words[0]);
+                        return UmpMessage(Words[0], (count > 1) ? Words[1] : 0, (count > 2) ? Words[2] : 0, (count > 3) ? Words[3] : 0);
+                    }
+
+                    /**
+                     * @brief Converts a MIDI 1.0 short message into a System or MIDI 1.0 Channel Voice packet.
+                     *
+                     * An empty message produces a NOOP packet.
+                     * @param Source Message to convert.
+                     * @param Group UMP group (0-15) of the packet.
+                     */
+                    static constexpr UmpMessage FromShortMessage(const ShortMessage& Source, uint8_t Group = 0) noexcept {
+                        return (Source.size() == 0) ? UmpMessage()
+                                                    : UmpMessage(Pack(Group, Source.Status(), Source.Data1(), Source.Data2()));
+                    }
+
+                    /**
+                     * @brief Builds a SysEx7 packet.
+                     * @param Group UMP group (0-15) of the packet.
+                     * @param Status Position of the packet within its message.
+                     * @param Data SysEx data bytes, without 0xF0 and 0xF7.
+                     * @param Size Number of data bytes, at most 6; extra bytes are ignored.
+                     */
+                    static constexpr UmpMessage SysEx7(uint8_t Group, UmpSysExStatus Status, const uint8_t* Data, size_t Size) noexcept {
+                        uint8_t bytes[6] = {0, 0, 0, 0, 0, 0};
+                        size_t count = (Size < 6) ? Size : 6;
+                        for (size_t i = 0; i < count; i++) {
+                            bytes[i] = Data[i] & 0x7F;
+                        }
+                        return UmpMessage((static_cast<uint32_t>(UmpType::Data64) << 28) | (static_cast<uint32_t>(Group & 0x0F) << 24)
+                                              | (static_cast<uint32_t>(Status) << 20) | (static_cast<uint32_t>(count) << 16)
+                                              | (static_cast<uint32_t>(bytes[0]) << 8) | bytes[1],
+                                          (static_cast<uint32_t>(bytes[2]) << 24) | (static_cast<uint32_t>(bytes[3]) << 16)
+                                              | (static_cast<uint32_t>(bytes[4]) << 8) | bytes[5]);
+                    }
+
+                    /**
+                     * @brief Converts a System or MIDI 1.0 Channel Voice packet back into a short message.
+                     * @return The message, or an empty message for any other packet type.
+                     */
+                    constexpr ShortMessage ToShortMessage() const noexcept {
+                        return (Type() == UmpType::System || Type() == UmpType::Midi1ChannelVoice)
+                                   ? ShortMessage(Status(), Data1(), Data2())
+                                   : ShortMessage();
+                    }
+
+                    /**
+                     * @brief Packs a MIDI 1.0 short message into the first word of a System or Channel Voice packet.
+                     *
+                     * The Message Type is derived from the status byte: System for 0xF0 and above,
+                     * MIDI 1.0 Channel Voice below.
+                     */
+                    static constexpr uint32_t Pack(uint8_t Group, uint8_t Status, uint8_t Data1, uint8_t Data2) noexcept {
+                        return (static_cast<uint32_t>((Status >= 0xF0) ? UmpType::System : UmpType::Midi1ChannelVoice) << 28)
+                             | (static_cast<uint32_t>(Group & 0x0F) << 24)
+                             | (static_cast<uint32_t>(Status) << 16)
+                             | (static_cast<uint32_t>(Data1 & 0x7F) << 8)
+                             | (Data2 & 0x7F);
+                    }
+
+                    /**
+                     * @brief Returns the number of words of a packet given its first word.
+                     *
+                     * Reserved Message Types are sized as specified for forward compatibility.
+                     */
+                    static constexpr size_t WordCount(uint32_t FirstWord) noexcept {
+                        // One nibble per Message Type, type 0 in the lowest nibble
+                        return static_cast<size_t>((0x4443322211422111ull >> (4 * (FirstWord >> 28))) & 0x0F);
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Data Access
+                * @{
+                */
+                    constexpr uint32_t Word(size_t index) const noexcept { return (index < 4) ? _Words[index] : 0; }         ///< Returns a packet word, or 0 when out of bounds.
+                    constexpr const uint32_t* Words() const noexcept { return _Words; }                                      ///< Returns the packet words.
+                    constexpr size_t WordCount() const noexcept { return WordCount(_Words[0]); }                             ///< Returns the packet size in words.
+                    constexpr UmpType Type() const noexcept { return static_cast<UmpType>(_Words[0] >> 28); }               ///< Returns the Message Type.
+                    constexpr uint8_t Group() const noexcept { return static_cast<uint8_t>((_Words[0] >> 24) & 0x0F); }     ///< Returns the UMP group.
+                    constexpr uint8_t Status() const noexcept { return static_cast<uint8_t>(_Words[0] >> 16); }             ///< Returns the status byte of a System or Channel Voice packet.
+                    constexpr uint8_t Data1() const noexcept { return static_cast<uint8_t>(_Words[0] >> 8) & 0x7F; }        ///< Returns the first data byte of a System or MIDI 1.0 Channel Voice packet.
+                    constexpr uint8_t Data2() const noexcept { return static_cast<uint8_t>(_Words[0]) & 0x7F; }             ///< Returns the second data byte of a System or MIDI 1.0 Channel Voice packet.
+
+                    /**
+                     * @brief Returns the position of a SysEx7 packet within its message.
+                     */
+                    constexpr UmpSysExStatus SysExStatus() const noexcept { return static_cast<UmpSysExStatus>((_Words[0] >> 20) & 0x0F); }
+
+                    /**
+                     * @brief Returns the number of data bytes carried by a SysEx7 packet (0-6).
+                     */
+                    constexpr size_t SysExSize() const noexcept {
+                        return (((_Words[0] >> 16) & 0x0F) < 6) ? ((_Words[0] >> 16) & 0x0F) : 6;
+                    }
+
+                    /**
+                     * @brief Returns a data byte of a SysEx7 packet, or 0 when out of bounds.
+                     */
+                    constexpr uint8_t SysExData(size_t index) const noexcept {
+                        return (index >= SysExSize()) ? 0
+                             : (index < 2)            ? static_cast<uint8_t>(_Words[0] >> (8 * (1 - index))) & 0x7F
+                                                      : static_cast<uint8_t>(_Words[1] >> (8 * (5 - index))) & 0x7F;
+                    }
+
+                    /**
+                     * @brief Copies the packet words into a caller provided array of at least `WordCount()` words.
+                     * @return The number of words written.
+                     */
+                    size_t CopyTo(uint32_t* Words) const noexcept {
+                        size_t count = WordCount();
+                        for (size_t i = 0; i < count; i++) {
+                            Words[i] = _Words[i];
+                        }
+                        return count;
+                    }
+
+                    constexpr bool operator==(const UmpMessage& Other) const noexcept {
+                        return _Words[0] == Other._Words[0] && _Words[1] == Other._Words[1] && _Words[2] == Other._Words[2] && _Words[3] == Other._Words[3];
+                    }
+                    constexpr bool operator!=(const UmpMessage& Other) const noexcept { return !(*this == Other); }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_UMP_MESSAGE_H
@@ -0,0 +1,197 @@
+#include "UmpTranslator.h"
+
+namespace MIDILAR::MidiCore{
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // To UMP
+
+        size_t UmpTranslator::_SysEx7(const uint8_t* Data, size_t Size, bool First, bool Last, uint8_t Group, uint32_t* Words) {
+            if (Size == 0 && !First && !Last) {
+                return 0; // Nothing to carry
+            }
+
+            size_t written = 0;
+            size_t offset = 0;
+            do {
+                size_t count = (Size - offset < 6) ? Size - offset : 6;
+                bool first = First && offset == 0;
+                bool last = Last && offset + count == Size;
+                UmpSysExStatus status = first ? (last ? UmpSysExStatus::Complete : UmpSysExStatus::Start)
+                                              : (last ? UmpSysExStatus::End : UmpSysExStatus::Continue);
+
+                UmpMessage packet = UmpMessage::SysEx7(Group, status, Data + offset, count);
+                Words[written++] = packet.Word(0);
+                Words[written++] = packet.Word(1);
+                offset += count;
+            } while (offset < Size);
+
+            return written;
+        }
+
+        size_t UmpTranslator::ToUmp(const uint8_t* Data, size_t Size, uint8_t Group, uint32_t* Words) {
+            if (Data == nullptr || Size == 0) {
+                return 0;
+            }
+
+            uint8_t status = Data[0];
+            if (status == MIDI_SYSEX_START) {
+                size_t end = (Size > 1 && Data[Size - 1] == MIDI_SYSEX_END) ? Size - 1 : Size;
+                return _SysEx7(Data + 1, end - 1, true, true, Group, Words);
+            }
+
+            uint8_t size = MidiProtocol::StatusTable[status].Size;
+            if (size == 0 || Size < size) {
+                return 0; // Data byte, undefined status byte or truncated message
+            }
+
+            Words[0] = UmpMessage::Pack(Group, status, (size > 1) ? Data[1] : 0, (size > 2) ? Data[2] : 0);
+            return 1;
+        }
+
+        size_t UmpTranslator::ToUmp(const uint8_t* Data, size_t Size, MessageParser::SysExChunk Position, uint8_t Group, uint32_t* Words) {
+            if (Data == nullptr) {
+                return 0;
+            }
+
+            bool first = (Position == MessageParser::SysExChunk::Start || Position == MessageParser::SysExChunk::Complete);
+            bool last = (Position == MessageParser::SysExChunk::End || Position == MessageParser::SysExChunk::Complete);
+            if (!first && !last && Position != MessageParser::SysExChunk::Continue) {
+                return 0; // Aborted
+            }
+
+            // Strip the 0xF0 and 0xF7 framing, UMP carries them in the packet status
+            if (first && Size > 0 && Data[0] == MIDI_SYSEX_START) {
+                Data++;
+                Size--;
+            }
+            if (last && Size > 0 && Data[Size - 1] == MIDI_SYSEX_END) {
+                Size--;
+            }
+
+            return _SysEx7(Data, Size, first, last, Group, Words);
+        }
+
+        size_t UmpTranslator::ToUmp(const MessageParser::Batch& Source, uint8_t Group, uint32_t* Words) {
+            const uint8_t* bytes = Source.Buffer();
+            uint32_t group = static_cast<uint32_t>(Group & 0x0F) << 24;
+            size_t written = 0;
+
+            for (size_t i = 0; i < Source.size(); i++) {
+                const MessageParser::BatchEntry& entry = Source.Entry(i);
+                const uint8_t* data = bytes + entry.Offset;
+
+                // Short messages from the parser are always complete, pack them without the checks of ToUmp()
+                if (entry.Size <= 3 && data[0] != MIDI_SYSEX_START) {
+                    uint32_t status = data[0];
+                    uint32_t type = (status >= 0xF0) ? static_cast<uint32_t>(UmpType::System) : static_cast<uint32_t>(UmpType::Midi1ChannelVoice);
+                    Words[written++] = (type << 28) | group | (status << 16)
+                                     | ((entry.Size > 1) ? static_cast<uint32_t>(data[1]) << 8 : 0)
+                                     | ((entry.Size > 2) ? data[2] : 0);
+                    continue;
+                }
+
+                written += ToUmp(data, entry.Size, Group, Words + written);
+            }
+
+            return written;
+        }
+
+        void UmpTranslator::ToUmp(const ShortMessage* Messages, size_t Count, uint8_t Group, uint32_t* Words) {
+            uint32_t group = static_cast<uint32_t>(Group & 0x0F) << 24;
+
+            for (size_t i = 0; i < Count; i++) {
+                // Packed as status | data1 << 8 | data2 << 16 | size << 24, unused data bytes are already zero
+                uint32_t packed = Messages[i].Packed();
+                uint32_t type = 2 - ((packed & 0xF0) == 0xF0);
+                uint32_t word = (type << 28) | group | ((packed & 0xFF) << 16) | (packed & 0xFF00) | ((packed >> 16) & 0xFF);
+                Words[i] = word & (0u - ((packed >> 24) != 0)); // NOOP for empty messages
+            }
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // To Bytes
+
+        UmpTranslator::UmpTranslator() noexcept
+            : _RunningStatusEnabled(false)
+        {
+            Reset();
+        }
+
+        void UmpTranslator::SetRunningStatus(bool Enabled) {
+            _RunningStatusEnabled = Enabled;
+            Reset();
+        }
+
+        void UmpTranslator::Reset() {
+            for (size_t group = 0; group < 16; group++) {
+                _RunningStatus[group] = 0;
+            }
+        }
+
+        size_t UmpTranslator::ToBytes(const uint32_t* Words, size_t Count, uint8_t Group, uint8_t* Out) {
+            if (Words == nullptr) {
+                return 0;
+            }
+
+            Group &= 0x0F;
+            uint8_t running = _RunningStatus[Group];
+            size_t written = 0;
+            size_t i = 0;
+
+            while (i < Count) {
+                uint32_t word = Words[i];
+                size_t count = UmpMessage::WordCount(word);
+                if (count > Count - i) {
+                    break; // Truncated packet
+                }
+                if (((word >> 24) & 0x0F) != Group) {
+                    i += count;
+                    continue;
+                }
+
+                UmpType type = static_cast<UmpType>(word >> 28);
+                uint8_t status = static_cast<uint8_t>(word >> 16);
+
+                if (type == UmpType::Midi1ChannelVoice && status >= 0x80 && status < 0xF0) {
+                    if (status != running) {
+                        Out[written++] = status;
+                        running = _RunningStatusEnabled ? status : 0;
+                    }
+                    Out[written++] = static_cast<uint8_t>(word >> 8) & 0x7F;
+                    if (MidiProtocol::StatusTable[status].Size == 3) {
+                        Out[written++] = static_cast<uint8_t>(word) & 0x7F;
+                    }
+                } else if (type == UmpType::System && MidiProtocol::StatusTable[status].Size != 0) {
+                    // Real-Time bytes leave the running status untouched, System Common messages cancel it
+                    uint8_t size = MidiProtocol::StatusTable[status].Size;
+                    if (status < MIDI_REALTIME_TIMING_TICK) {
+                        running = 0;
+                    }
+                    Out[written++] = status;
+                    if (size > 1) Out[written++] = static_cast<uint8_t>(word >> 8) & 0x7F;
+                    if (size > 2) Out[written++] = static_cast<uint8_t>(word) & 0x7F;
+                } else if (type == UmpType::Data64 && ((word >> 20) & 0x0F) <= static_cast<uint32_t>(UmpSysExStatus::End)) {
+                    UmpMessage packet(word, Words[i + 1]);
+                    UmpSysExStatus position = packet.SysExStatus();
+                    running = 0;
+
+                    if (position == UmpSysExStatus::Complete || position == UmpSysExStatus::Start) {
+                        Out[written++] = MIDI_SYSEX_START;
+                    }
+                    for (size_t byte = 0; byte < packet.SysExSize(); byte++) {
+                        Out[written++] = packet.SysExData(byte);
+                    }
+                    if (position == UmpSysExStatus::Complete || position == UmpSysExStatus::End) {
+                        Out[written++] = MIDI_SYSEX_END;
+                    }
+                }
+
+                i += count;
+            }
+
+            _RunningStatus[Group] = running;
+            return written;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
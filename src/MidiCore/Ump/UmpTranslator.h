@@ -0,0 +1,180 @@
+#ifndef MIDILAR_MIDI_UMP_TRANSLATOR_H
+#define MIDILAR_MIDI_UMP_TRANSLATOR_H
+
+/**
+ * @file UmpTranslator.h
+ * @brief Provides the `UmpTranslator` class converting MIDI 1.0 byte streams to and from Universal MIDI Packets.
+ */
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <MidiCore/Message/ShortMessage.h>
+    #include <MidiCore/MessageParser/MessageParser.h>
+    #include <MidiCore/Ump/UmpMessage.h>
+
+    namespace MIDILAR::MidiCore{
+
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @class UmpTranslator
+         * @brief Bulk translator between MIDI 1.0 messages and Universal MIDI Packet word arrays.
+         *
+         * **To UMP**: the `ToUmp()` functions take the messages delivered by `MessageParser` (single
+         * messages, streamed SysEx chunks or whole batches) and write MIDI 1.0 Channel Voice and System
+         * packets, one word per message, and SysEx7 packets, two words per 6 data bytes. They are static
+         * and keep no state: the parser has already resolved running status and SysEx boundaries.
+         *
+         * **To bytes**: `ToBytes()` turns the packets of one group back into a MIDI 1.0 byte stream,
+         * omitting repeated Channel Voice status bytes when running status is enabled. The running status
+         * of every group is kept between calls, so a bridge can decode the 16 groups of an endpoint from
+         * the same word array with one call per group.
+         *
+         * Like `SysExCodec`, every function works on caller-supplied arrays, never allocates and returns
+         * the number of words or bytes written. Output arrays must hold at least `EncodedSize()` words or
+         * `DecodedSize()` bytes.
+         *
+         * ## Example Usage:
+         * ```cpp
+         * void OnBatch(const MessageParser::Batch& batch) {
+         *     uint32_t words[UmpTranslator::EncodedSize(BatchBytes)];
+         *     size_t count = UmpTranslator::ToUmp(batch, group, words);
+         *     endpoint.Send(words, count);
+         * }
+         *
+         * UmpTranslator translator;
+         * size_t size = translator.ToBytes(words, count, 0, bytes); // First group only
+         * ```
+         *
+         * @see MIDILAR::MidiCore::UmpMessage
+         */
+            class UmpTranslator {
+
+            private:
+                uint8_t _RunningStatus[16];     ///< Channel Voice status byte last written for each group, 0 when none.
+                bool _RunningStatusEnabled;
+
+                /**
+                 * @brief Splits SysEx data bytes into SysEx7 packets.
+                 * @param First True if the data starts the message.
+                 * @param Last True if the data ends the message.
+                 */
+                static size_t _SysEx7(const uint8_t* Data, size_t Size, bool First, bool Last, uint8_t Group, uint32_t* Words);
+
+            public:
+
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name Sizes
+                * @{
+                */
+                    /**
+                     * @brief Returns the maximum number of words produced from `Bytes` bytes of messages or SysEx chunks.
+                     */
+                    static constexpr size_t EncodedSize(size_t Bytes) {
+                        return Bytes + 2;
+                    }
+
+                    /**
+                     * @brief Returns the maximum number of bytes produced from `Words` packet words.
+                     */
+                    static constexpr size_t DecodedSize(size_t Words) {
+                        return Words * 4;
+                    }
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name To UMP
+                * @{
+                */
+                    /**
+                     * @brief Translates one complete message, as delivered by the `MessageParser` callbacks.
+                     * @param Data Message bytes, starting with the status byte. SysEx runs from 0xF0 to 0xF7.
+                     * @param Size Number of message bytes.
+                     * @param Group UMP group (0-15) of the packets.
+                     * @param Words Destination, at least `EncodedSize(Size)` words.
+                     * @return Number of words written, 0 if `Data` does not start with a valid status byte.
+                     */
+                    static size_t ToUmp(const uint8_t* Data, size_t Size, uint8_t Group, uint32_t* Words);
+
+                    /**
+                     * @brief Translates one streamed SysEx chunk, as delivered by the SysEx stream callback.
+                     *
+                     * An aborted message produces no packet; the receiver discards it on the next Start packet.
+                     * @param Data Chunk bytes.
+                     * @param Size Number of chunk bytes.
+                     * @param Position Position of the chunk within its message.
+                     * @param Group UMP group (0-15) of the packets.
+                     * @param Words Destination, at least `EncodedSize(Size)` words.
+                     * @return Number of words written.
+                     */
+                    static size_t ToUmp(const uint8_t* Data, size_t Size, MessageParser::SysExChunk Position, uint8_t Group, uint32_t* Words);
+
+                    /**
+                     * @brief Translates every message of a batch, in order.
+                     * @param Source Batch delivered by the batch callback.
+                     * @param Group UMP group (0-15) of the packets.
+                     * @param Words Destination, at least `EncodedSize(Source.ByteSize())` words.
+                     * @return Number of words written.
+                     */
+                    static size_t ToUmp(const MessageParser::Batch& Source, uint8_t Group, uint32_t* Words);
+
+                    /**
+                     * @brief Translates an array of short messages, one word each.
+                     *
+                     * The loop has no branch and is vectorized by the compiler. Empty messages become
+                     * NOOP words, so `Words[i]` always matches `Messages[i]`.
+                     * @param Messages Messages to translate.
+                     * @param Count Number of messages.
+                     * @param Group UMP group (0-15) of the packets.
+                     * @param Words Destination, at least `Count` words.
+                     */
+                    static void ToUmp(const ShortMessage* Messages, size_t Count, uint8_t Group, uint32_t* Words);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+               /**
+                * @name To Bytes
+                * @{
+                */
+                    /**
+                     * @brief Constructs a translator with running status disabled.
+                     */
+                    UmpTranslator() noexcept;
+
+                    /**
+                     * @brief Enables or disables running status in the byte streams written by `ToBytes()`.
+                     */
+                    void SetRunningStatus(bool Enabled);
+
+                    /**
+                     * @brief Returns true if running status is enabled.
+                     */
+                    bool RunningStatusEnabled() const { return _RunningStatusEnabled; }
+
+                    /**
+                     * @brief Forgets the running status of every group, so the next message is written in full.
+                     */
+                    void Reset();
+
+                    /**
+                     * @brief Translates the System, MIDI 1.0 Channel Voice and SysEx7 packets of one group into bytes.
+                     *
+                     * Packets of other groups and other Message Types are skipped, as is a packet truncated
+                     * by the end of the array.
+                     * @param Words Packet words.
+                     * @param Count Number of words.
+                     * @param Group UMP group (0-15) to translate.
+                     * @param Out Destination, at least `DecodedSize(Count)` bytes.
+                     * @return Number of bytes written.
+                     */
+                    size_t ToBytes(const uint32_t* Words, size_t Count, uint8_t Group, uint8_t* Out);
+               /**@}*/ //
+               ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            };
+        //
+        //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    }
+
+#endif//MIDILAR_MIDI_UMP_TRANSLATOR_H
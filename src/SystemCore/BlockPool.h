@@ -0,0 +1,11 @@
+#ifndef MIDILAR_SYSTEM_BLOCK_POOL_TOP_H
+#define MIDILAR_SYSTEM_BLOCK_POOL_TOP_H
+
+    #include <MIDILAR_BuildSettings.h>
+    
+    #if __has_include(<SystemCore/BlockPool/BlockPool.h>)
+        #define MIDILAR_SYSTEM_BLOCK_POOL
+        #include <SystemCore/BlockPool/BlockPool.h>
+    #endif
+
+#endif//MIDILAR_SYSTEM_BLOCK_POOL_TOP_H
\ No newline at end of file
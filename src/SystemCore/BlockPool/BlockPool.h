@@ -0,0 +1,97 @@
+#ifndef MIDILAR_SYSTEM_BLOCKPOOL_H
+#define MIDILAR_SYSTEM_BLOCKPOOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if __has_include(<atomic>)
+    #include <atomic>
+#endif
+
+namespace MIDILAR::SystemCore {
+
+    #if __has_include(<atomic>)
+        template <typename T>
+        using BlockPoolAtomic = std::atomic<T>;
+    #else
+        /**
+         * @brief Plain stand-in for `std::atomic` on toolchains without `<atomic>`.
+         *
+         * Pools built on it are only safe when every allocation and release happens
+         * from the same execution context.
+         */
+        template <typename T>
+        struct BlockPoolAtomic {
+            T _Value;
+
+            T load() const { return _Value; }
+            void store(T Value) { _Value = Value; }
+            T fetch_add(T Value) { T old = _Value; _Value += Value; return old; }
+            T fetch_sub(T Value) { T old = _Value; _Value -= Value; return old; }
+            bool compare_exchange_weak(T& Expected, T Desired) {
+                if (_Value != Expected) {
+                    Expected = _Value;
+                    return false;
+                }
+                _Value = Desired;
+                return true;
+            }
+        };
+    #endif
+
+    /**
+     * @brief Fixed-size block allocator with a lock-free free list.
+     *
+     * The pool owns `Count` blocks of `Size` bytes. Free blocks are kept in a Treiber stack
+     * whose head carries a 16-bit tag next to the block index, so a block released and
+     * reallocated between a read and a compare-exchange cannot corrupt the list. Allocation
+     * and release are therefore safe from interrupts and concurrent threads on targets with
+     * lock-free 32-bit atomics.
+     *
+     * The pool keeps usage statistics to help sizing it per deployment: blocks in use, the
+     * high-water mark, and the number of allocations that failed because the pool was empty.
+     *
+     * @tparam Size Size of one block in bytes.
+     * @tparam Count Number of blocks, at most 65534.
+     */
+    template <size_t Size, size_t Count>
+    class BlockPool {
+
+        static_assert(Size > 0, "BlockPool block size must not be zero");
+        static_assert(Count > 0 && Count < 0xFFFF, "BlockPool holds between 1 and 65534 blocks");
+
+    public:
+        static constexpr size_t BlockSize = Size;   ///< Size of one block in bytes.
+        static constexpr size_t BlockCount = Count; ///< Number of blocks in the pool.
+
+    private:
+        static constexpr uint16_t _End = 0xFFFF;    ///< Free list terminator.
+
+        alignas(sizeof(void*)) uint8_t _Storage[Size * Count];
+        BlockPoolAtomic<uint16_t> _Next[Count];     ///< Next free block of each free block.
+        BlockPoolAtomic<uint32_t> _Head;            ///< Tag in bits 16-31, first free block in bits 0-15.
+
+        BlockPoolAtomic<uint32_t> _InUse;
+        BlockPoolAtomic<uint32_t> _HighWater;
+        BlockPoolAtomic<uint32_t> _Failed;
+
+    public:
+        BlockPool();
+
+        void* Allocate();                       ///< Returns a free block, or nullptr if the pool is empty.
+        bool Deallocate(void* Block);           ///< Returns a block to the pool. False if the block does not belong to it.
+        bool Owns(const void* Block) const;     ///< Returns true if the pointer is a block of this pool.
+
+        size_t InUse() const;                   ///< Number of blocks currently allocated.
+        size_t HighWaterMark() const;           ///< Largest number of blocks allocated at once.
+        size_t FailedAllocations() const;       ///< Number of allocations refused because the pool was empty.
+        void ResetStatistics();                 ///< Restarts the high-water mark from the current usage and clears the failure count.
+
+        void Reset();                           ///< Marks every block as free. Not safe while blocks are in use.
+    };
+
+}
+
+#include "BlockPool.tpp"
+
+#endif//MIDILAR_SYSTEM_BLOCKPOOL_H
@@ -0,0 +1,97 @@
+#include "BlockPool.h"
+
+namespace MIDILAR::SystemCore {
+
+    template <size_t Size, size_t Count>
+    BlockPool<Size, Count>::BlockPool() {
+        Reset();
+    }
+
+    template <size_t Size, size_t Count>
+    void* BlockPool<Size, Count>::Allocate() {
+        uint32_t head = _Head.load();
+        uint16_t index;
+
+        while (true) {
+            index = static_cast<uint16_t>(head & 0xFFFF);
+            if (index == _End) {
+                _Failed.fetch_add(1);
+                return nullptr;
+            }
+
+            // Bumping the tag makes a concurrent pop/push pair on the same block fail the exchange
+            uint32_t next = ((head + 0x10000) & 0xFFFF0000) | _Next[index].load();
+            if (_Head.compare_exchange_weak(head, next)) {
+                break;
+            }
+        }
+
+        uint32_t used = _InUse.fetch_add(1) + 1;
+        uint32_t high = _HighWater.load();
+        while (used > high && !_HighWater.compare_exchange_weak(high, used)) {
+        }
+
+        return _Storage + static_cast<size_t>(index) * Size;
+    }
+
+    template <size_t Size, size_t Count>
+    bool BlockPool<Size, Count>::Deallocate(void* Block) {
+        if (!Owns(Block)) {
+            return false;
+        }
+
+        uint16_t index = static_cast<uint16_t>((static_cast<uint8_t*>(Block) - _Storage) / Size);
+        uint32_t head = _Head.load();
+        uint32_t next;
+
+        do {
+            _Next[index].store(static_cast<uint16_t>(head & 0xFFFF));
+            next = ((head + 0x10000) & 0xFFFF0000) | index;
+        } while (!_Head.compare_exchange_weak(head, next));
+
+        _InUse.fetch_sub(1);
+        return true;
+    }
+
+    template <size_t Size, size_t Count>
+    bool BlockPool<Size, Count>::Owns(const void* Block) const {
+        uintptr_t address = reinterpret_cast<uintptr_t>(Block);
+        uintptr_t begin = reinterpret_cast<uintptr_t>(_Storage);
+
+        return address >= begin && address < begin + sizeof(_Storage) && ((address - begin) % Size) == 0;
+    }
+
+    template <size_t Size, size_t Count>
+    size_t BlockPool<Size, Count>::InUse() const {
+        return _InUse.load();
+    }
+
+    template <size_t Size, size_t Count>
+    size_t BlockPool<Size, Count>::HighWaterMark() const {
+        return _HighWater.load();
+    }
+
+    template <size_t Size, size_t Count>
+    size_t BlockPool<Size, Count>::FailedAllocations() const {
+        return _Failed.load();
+    }
+
+    template <size_t Size, size_t Count>
+    void BlockPool<Size, Count>::ResetStatistics() {
+        _HighWater.store(_InUse.load());
+        _Failed.store(0);
+    }
+
+    template <size_t Size, size_t Count>
+    void BlockPool<Size, Count>::Reset() {
+        for (size_t i = 0; i < Count; i++) {
+            _Next[i].store(static_cast<uint16_t>((i + 1 < Count) ? (i + 1) : _End));
+        }
+
+        _Head.store(0);
+        _InUse.store(0);
+        _HighWater.store(0);
+        _Failed.store(0);
+    }
+
+}
@@ -14,4 +14,10 @@ if(MIDILAR_SYSTEM_RING_BUFFER)
     message(STATUS "MIDILAR::SystemCore::RingBuffer")
     target_compile_definitions(MIDILAR PUBLIC MIDILAR_SYSTEM_RING_BUFFER)
     list(APPEND ${PROJECT_NAME_UPPER}_MACROS "MIDILAR_SYSTEM_RING_BUFFER")
+endif()
+
+if(MIDILAR_SYSTEM_BLOCK_POOL)
+    message(STATUS "MIDILAR::SystemCore::BlockPool")
+    target_compile_definitions(MIDILAR PUBLIC MIDILAR_SYSTEM_BLOCK_POOL)
+    list(APPEND ${PROJECT_NAME_UPPER}_MACROS "MIDILAR_SYSTEM_BLOCK_POOL")
 endif()
\ No newline at end of file
@@ -3,12 +3,14 @@
     if(MIDILAR_FULL_BUILD)
         set(MIDILAR_SYSTEM_CALLBACK_HANDLER ON)
         set(MIDILAR_SYSTEM_CLOCK ON)
+        set(MIDILAR_SYSTEM_BLOCK_POOL ON)
     endif()
 #
 #################################################################################################################################
 # CallbackHandler
 
     option(MIDILAR_SYSTEM_CALLBACK_HANDLER "Enables the compilation of MIDILAR::SystemCore::CallbackHandler" ON)
+    set(MIDILAR_SYSTEM_CALLBACK_INLINE_SIZE 16 CACHE STRING "Bytes a MIDILAR::SystemCore::CallbackHandler stores inline for its target, bounding the size of bound lambdas")
 #
 ##################################################################################################################################
 # Clock
@@ -20,4 +22,9 @@
 
     option(MIDILAR_SYSTEM_RING_BUFFER "Enables the compilation of MIDILAR::SystemCore::RingBuffer" ON)
 #
+##################################################################################################################################
+# BlockPool
+
+    option(MIDILAR_SYSTEM_BLOCK_POOL "Enables the compilation of MIDILAR::SystemCore::BlockPool" ON)
+#
 #################################################################################################################################
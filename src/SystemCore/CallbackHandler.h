@@ -6,6 +6,8 @@
     #if __has_include(<SystemCore/CallbackHandler/CallbackHandler.h>)
         #define MIDILAR_SYSTEM_CALLBACK_HANDLER
         #include <SystemCore/CallbackHandler/CallbackHandler.h>
+        #include <SystemCore/CallbackHandler/CallbackList.h>
+        #include <SystemCore/CallbackHandler/AtomicCallbackHandler.h>
     #endif
     
 #endif//MIDILAR_SYSTEM_CALLBACK_HANDLER_H
\ No newline at end of file
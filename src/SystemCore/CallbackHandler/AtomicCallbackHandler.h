@@ -0,0 +1,181 @@
+#ifndef MIDILAR_SYSTEM_ATOMIC_CALLBACK_HANDLER_H
+#define MIDILAR_SYSTEM_ATOMIC_CALLBACK_HANDLER_H
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #include <SystemCore/CallbackHandler/CallbackHandler.h>
+
+    #if __has_include(<atomic>)
+        #include <atomic>
+    #endif
+
+    namespace MIDILAR::SystemCore {
+
+        #if __has_include(<atomic>)
+            template <typename T>
+            using AtomicCallbackHandlerAtomic = std::atomic<T>;
+        #else
+            /**
+             * @brief Plain stand-in for `std::atomic` on toolchains without `<atomic>`.
+             *
+             * Handlers built on it are only safe when binding and invocation happen from the same
+             * execution context.
+             */
+            template <typename T>
+            struct AtomicCallbackHandlerAtomic {
+                T _Value;
+
+                T load() const { return _Value; }
+                void store(T Value) { _Value = Value; }
+                T fetch_add(T Value) { T old = _Value; _Value += Value; return old; }
+                T fetch_sub(T Value) { T old = _Value; _Value -= Value; return old; }
+            };
+        #endif
+
+        //////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief `CallbackHandler` that can be rebound from one thread while other threads invoke it.
+         *
+         * The handler keeps two `CallbackHandler` slots and follows the Left-Right scheme: binding
+         * writes the slot no reader uses, then publishes it with a single atomic store, so an
+         * invocation always sees a complete target, old or new. Invocation is wait-free: it
+         * registers on a reader counter, calls the published slot and deregisters, without loops
+         * or locks, from any number of threads.
+         *
+         * The previous target may still be running after `bind()` returns. `quiescent()` tells
+         * without blocking whether it is done, and `synchronize()` waits for it, for instance
+         * before destroying the old instance. Binding again while the previous target is still in
+         * use waits for it first. One thread binds at a time.
+         *
+         * `invoke` is a plain member function, so the handler can sit behind any single-target API
+         * and be rebound later from another thread:
+         * ```cpp
+         * AtomicCallbackHandler<void, const uint8_t*, size_t> notes;
+         * parser.BindChannelVoiceCallback<decltype(notes), &decltype(notes)::invoke>(&notes);
+         *
+         * notes.bind<Synth, &Synth::OnNote>(&newSynth);   // UI thread, while the MIDI thread parses
+         * notes.synchronize();
+         * delete oldSynth;
+         * ```
+         *
+         * @tparam R Return type of the callback function.
+         * @tparam Args Parameter types of the callback function. `void` alone means no parameter.
+         */
+        template <typename R, typename... Args>
+        class AtomicCallbackHandler {
+            public:
+                using CallbackType = typename CallbackHandler<R, Args...>::CallbackType;
+
+            private:
+                CallbackHandler<R, Args...> _Slots[2];
+                AtomicCallbackHandlerAtomic<uint8_t> _Active;      ///< Slot called by new invocations.
+                AtomicCallbackHandlerAtomic<uint8_t> _Version;     ///< Reader counter used by new invocations.
+                AtomicCallbackHandlerAtomic<uint32_t> _Readers[2]; ///< Invocations in progress, per version.
+                uint8_t _Retiring;                                  ///< Steps left before the inactive slot is free. Binding thread only.
+
+                /**
+                 * @brief Registers an invocation for its whole duration, even if the target throws.
+                 */
+                class _ReadGuard {
+                    private:
+                        AtomicCallbackHandlerAtomic<uint32_t>& _Counter;
+
+                    public:
+                        uint8_t Slot;
+
+                        explicit _ReadGuard(AtomicCallbackHandler& Handler)
+                            : _Counter(Handler._Readers[Handler._Version.load()]) {
+                            _Counter.fetch_add(1);
+                            Slot = Handler._Active.load();
+                        }
+
+                        ~_ReadGuard() {
+                            _Counter.fetch_sub(1);
+                        }
+
+                        _ReadGuard(const _ReadGuard&) = delete;
+                        _ReadGuard& operator=(const _ReadGuard&) = delete;
+                };
+
+                CallbackHandler<R, Args...>& _Inactive();
+                void _Publish();
+
+            public:
+                AtomicCallbackHandler();
+
+                AtomicCallbackHandler(const AtomicCallbackHandler&) = delete;
+                AtomicCallbackHandler& operator=(const AtomicCallbackHandler&) = delete;
+
+                void bind(CallbackType Callback) {
+                    _Inactive().bind(Callback);
+                    _Publish();
+                }
+
+                template <typename T, R (T::*Method)(Args...)>
+                void bind(T* instance) {
+                    _Inactive().template bind<T, Method>(instance);
+                    _Publish();
+                }
+
+                /**
+                 * @brief Binds a copy of a function object, see `CallbackHandler::bind(const F&)`.
+                 */
+                template <typename F>
+                void bind(const F& Callable) {
+                    _Inactive().bind(Callable);
+                    _Publish();
+                }
+
+                void bind(decltype(nullptr)) {
+                    unbind();
+                }
+
+                void unbind() {
+                    _Inactive().unbind();
+                    _Publish();
+                }
+
+                /**
+                 * @brief Returns true once no invocation can still reach the target replaced by the last bind.
+                 *
+                 * Never blocks. Call it from the binding thread.
+                 */
+                bool quiescent();
+
+                /**
+                 * @brief Waits until no invocation can still reach the target replaced by the last bind.
+                 *
+                 * Spins without blocking the invoking threads; never call it from a target.
+                 */
+                void synchronize();
+
+                [[nodiscard]] bool status();
+
+                /**
+                 * @brief Calls the bound target. Wait-free, and safe from any number of threads.
+                 */
+                R invoke(Args... args) {
+                    _ReadGuard guard(*this);
+                    return _Slots[guard.Slot].invoke(args...);
+                }
+        };
+
+        //////////////////////////////////////////////////////////////////////////////////////////////
+        /// \cond INTERNAL
+
+        /**
+         * @brief `AtomicCallbackHandler<R, void>` is the handler of callbacks without parameters.
+         */
+        template <typename R>
+        class AtomicCallbackHandler<R, void> : public AtomicCallbackHandler<R> {
+        };
+
+        /// \endcond
+
+    } // namespace MIDILAR::SystemCore
+
+    #include "AtomicCallbackHandler.tpp"
+
+#endif // MIDILAR_SYSTEM_ATOMIC_CALLBACK_HANDLER_H
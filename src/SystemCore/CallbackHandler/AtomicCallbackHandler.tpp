@@ -0,0 +1,65 @@
+#include "AtomicCallbackHandler.h"
+
+namespace MIDILAR::SystemCore {
+
+    template <typename R, typename... Args>
+    AtomicCallbackHandler<R, Args...>::AtomicCallbackHandler()
+        : _Retiring(0)
+    {
+        _Active.store(0);
+        _Version.store(0);
+        _Readers[0].store(0);
+        _Readers[1].store(0);
+    }
+
+    template <typename R, typename... Args>
+    CallbackHandler<R, Args...>& AtomicCallbackHandler<R, Args...>::_Inactive() {
+        // The inactive slot may still be read by invocations that started before the last bind
+        synchronize();
+        return _Slots[1 - _Active.load()];
+    }
+
+    template <typename R, typename... Args>
+    void AtomicCallbackHandler<R, Args...>::_Publish() {
+        _Active.store(static_cast<uint8_t>(1 - _Active.load()));
+        _Retiring = 2;
+        quiescent(); // Often already done when no invocation is running
+    }
+
+    template <typename R, typename... Args>
+    bool AtomicCallbackHandler<R, Args...>::quiescent() {
+        // Drain the reader counter new invocations are about to use, switch them to it, then drain
+        // the one used by invocations that may have read the previous slot
+        if (_Retiring == 2) {
+            uint8_t next = static_cast<uint8_t>(1 - _Version.load());
+            if (_Readers[next].load() != 0) {
+                return false;
+            }
+            _Version.store(next);
+            _Retiring = 1;
+        }
+
+        if (_Retiring == 1) {
+            uint8_t previous = static_cast<uint8_t>(1 - _Version.load());
+            if (_Readers[previous].load() != 0) {
+                return false;
+            }
+            _Retiring = 0;
+        }
+
+        return true;
+    }
+
+    template <typename R, typename... Args>
+    void AtomicCallbackHandler<R, Args...>::synchronize() {
+        while (!quiescent()) {
+        }
+    }
+
+    template <typename R, typename... Args>
+    bool AtomicCallbackHandler<R, Args...>::status() {
+        _ReadGuard guard(*this);
+        return _Slots[guard.Slot].status();
+    }
+
+}
@@ -2,245 +2,149 @@
 #define MIDILAR_SYSTEM_CALLBACK_HANDLER_H
 
     #include <MIDILAR_BuildSettings.h>
+    #include <stddef.h>
+    #include <string.h>
 
     #ifdef MIDILAR_EXCEPTIONS
         #include <stdexcept>
     #endif
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief Bytes a `CallbackHandler` reserves for its target.
+     *
+     * Bounds the size of the capturing callables that can be bound. The default keeps a handler
+     * at three pointers on 64-bit targets. Can be overridden at build time.
+     */
+    #ifndef MIDILAR_CALLBACK_INLINE_SIZE
+        #define MIDILAR_CALLBACK_INLINE_SIZE 16
+    #endif
+
     namespace MIDILAR::SystemCore {
 
         //////////////////////////////////////////////////////////////////////////////////////////////
         /**
          * @brief A generic callback handler for function pointers with multiple parameters.
-         * 
+         *
          * This template class provides a mechanism to store, bind, and invoke callbacks dynamically.
-         * It supports both function pointers, lambda functions, and non-static member functions.
-         * 
+         * It supports function pointers, non-static member functions, and lambdas and other function
+         * objects, including ones with captures.
+         *
+         * Every target is stored in an inline buffer of `MIDILAR_CALLBACK_INLINE_SIZE` bytes and called
+         * through a single function pointer: binding never allocates. Function objects must be
+         * trivially copyable and fit in the buffer, which is checked at compile time.
+         *
          * @tparam R Return type of the callback function.
-         * @tparam Args Parameter types of the callback function.
+         * @tparam Args Parameter types of the callback function. `void` alone means no parameter.
          */
 
         template <typename R, typename... Args>
         class CallbackHandler {
-            private:
-                struct CallbackContext {
-                    void* instance;  // Pointer to the instance (could be any class)
-                    R (*invoke)(void*, Args... args);  // Function pointer for invocation
-                };
-
             public:
                 using CallbackType = R (*)(Args...);
 
-                CallbackHandler() : _callback(nullptr), _context{nullptr, nullptr} {}
-                
-                inline void bind(CallbackType Callback) {
-                    _callback = Callback;
-                    _context = {nullptr, nullptr};
-                }
-
-                template <typename T, R (T::*Method)(Args...)>
-                void bind(T* instance) {
-                    _callback = nullptr;
-                    _context.instance = static_cast<void*>(instance);
-                    _context.invoke = [](void* obj, Args... args) -> R {
-                        return (static_cast<T*>(obj)->*Method)(args...);
-                    };
-                }
-
-                inline void unbind() {
-                    _callback = nullptr;
-                    _context = {nullptr, nullptr};
-                }
-
-                [[nodiscard]] inline bool status() const {
-                    return (_callback != nullptr) || (_context.invoke && _context.instance);
-                }
-
-                R invoke(Args... args) const {
-                    if (_context.invoke && _context.instance) {
-                        return _context.invoke(_context.instance, args...);
-                    }
-                    if (_callback) {
-                        return _callback(args...);
-                    }
-                    #ifdef MIDILAR_EXCEPTIONS
-                        throw std::runtime_error("Callback is not bound");
-                    #endif
-                    return R();
-                }
-
-            private:
-                CallbackType _callback;
-                CallbackContext _context = {nullptr, nullptr};
-        };
-
-        //////////////////////////////////////////////////////////////////////////////////////////////
-        /// \cond INTERNAL
+                static constexpr size_t InlineSize = MIDILAR_CALLBACK_INLINE_SIZE; ///< Bytes available for the bound target.
 
-        template <typename R>
-        class CallbackHandler<R, void> {
             private:
-                struct CallbackContext {
-                    void* instance;
-                    R (*invoke)(void*);
-                };
+                static constexpr size_t _Alignment = (alignof(double) > alignof(void*)) ? alignof(double) : alignof(void*);
 
-            public:
-                using CallbackType = R (*)();
+                static_assert(InlineSize >= sizeof(void*) && InlineSize >= sizeof(CallbackType),
+                              "MIDILAR_CALLBACK_INLINE_SIZE must hold at least a pointer");
 
-                CallbackHandler() : _callback(nullptr), _context{nullptr, nullptr} {}
-                
-                inline void bind(CallbackType Callback) {
-                    _callback = Callback;
-                    _context = {nullptr, nullptr};
-                }
+                using InvokerType = R (*)(const void*, Args...);
 
-                template <typename T, R (T::*Method)()>
-                void bind(T* instance) {
-                    _callback = nullptr;
-                    _context.instance = static_cast<void*>(instance);
-                    _context.invoke = [](void* obj) -> R {
-                        return (static_cast<T*>(obj)->*Method)();
-                    };
+                static R _CallFunction(const void* storage, Args... args) {
+                    CallbackType callback;
+                    memcpy(&callback, storage, sizeof(callback));
+                    return callback(args...);
                 }
 
-                inline void unbind() {
-                    _callback = nullptr;
-                    _context = {nullptr, nullptr};
+                template <typename T, R (T::*Method)(Args...)>
+                static R _CallMethod(const void* storage, Args... args) {
+                    T* instance;
+                    memcpy(&instance, storage, sizeof(instance));
+                    return (instance->*Method)(args...);
                 }
 
-                [[nodiscard]] inline bool status() const {
-                    return (_callback != nullptr) || (_context.invoke && _context.instance);
+                template <typename F>
+                static R _CallObject(const void* storage, Args... args) {
+                    return (*static_cast<const F*>(storage))(args...);
                 }
 
-                R invoke() const {
-                    if (_context.invoke && _context.instance) {
-                        return _context.invoke(_context.instance);
-                    }
-                    if (_callback) {
-                        return _callback();
-                    }
-                    #ifdef MIDILAR_EXCEPTIONS
-                        throw std::runtime_error("Callback is not bound");
-                    #endif
-                    return R();
-                }
-
-            private:
-                CallbackType _callback;
-                CallbackContext _context = {nullptr, nullptr};
-        };
-
-        template <typename... Args>
-        class CallbackHandler<void, Args...> {
-            private:
-                struct CallbackContext {
-                    void* instance;
-                    void (*invoke)(void*, Args...);
-                };
-
             public:
-                using CallbackType = void (*)(Args...);
+                CallbackHandler() : _invoke(nullptr), _storage{} {}
 
-                CallbackHandler() : _callback(nullptr), _context{nullptr, nullptr} {}
-                
                 inline void bind(CallbackType Callback) {
-                    _callback = Callback;
-                    _context = {nullptr, nullptr};
+                    if (Callback == nullptr) {
+                        unbind();
+                        return;
+                    }
+                    memcpy(_storage, &Callback, sizeof(Callback));
+                    _invoke = &_CallFunction;
                 }
 
-                template <typename T, void (T::*Method)(Args...)>
+                template <typename T, R (T::*Method)(Args...)>
                 void bind(T* instance) {
-                    _callback = nullptr;
-                    _context.instance = static_cast<void*>(instance);
-                    _context.invoke = [](void* obj, Args... args) {
-                        (static_cast<T*>(obj)->*Method)(args...);
-                    };
-                }
-
-                inline void unbind() {
-                    _callback = nullptr;
-                    _context = {nullptr, nullptr};
-                }
-
-                [[nodiscard]] inline bool status() const {
-                    return (_callback != nullptr) || (_context.invoke && _context.instance);
-                }
-
-                void invoke(Args... args) const {
-                    if (_context.invoke && _context.instance) {
-                        _context.invoke(_context.instance, args...);
+                    if (instance == nullptr) {
+                        unbind();
                         return;
                     }
-                    if (_callback) {
-                        _callback(args...);
-                        return;
-                    }
-                    #ifdef MIDILAR_EXCEPTIONS
-                        throw std::runtime_error("Callback is not bound");
-                    #endif
+                    memcpy(_storage, &instance, sizeof(instance));
+                    _invoke = &_CallMethod<T, Method>;
                 }
 
-            private:
-                CallbackType _callback;
-                CallbackContext _context = {nullptr, nullptr};
-        };
-
-        template <>
-        class CallbackHandler<void, void> {
-            private:
-                struct CallbackContext {
-                    void* instance;
-                    void (*invoke)(void*);
-                };
-
-            public:
-                using CallbackType = void (*)();
-
-                CallbackHandler() : _callback(nullptr), _context{nullptr, nullptr} {}
-                
-                inline void bind(CallbackType Callback) {
-                    _callback = Callback;
-                    _context = {nullptr, nullptr};
+                /**
+                 * @brief Binds a copy of a function object, such as a lambda with captures.
+                 *
+                 * The object is called as `const`, so mutable lambdas are not accepted.
+                 * @tparam F Type of the function object; trivially copyable and at most `InlineSize` bytes.
+                 */
+                template <typename F>
+                void bind(const F& Callable) {
+                    static_assert(sizeof(F) <= InlineSize, "Callable too large for CallbackHandler, raise MIDILAR_CALLBACK_INLINE_SIZE");
+                    static_assert(alignof(F) <= _Alignment, "Callable over-aligned for CallbackHandler");
+                    static_assert(__is_trivially_copyable(F), "CallbackHandler only stores trivially copyable callables");
+                    memcpy(_storage, &Callable, sizeof(F));
+                    _invoke = &_CallObject<F>;
                 }
 
-                template <typename T, void (T::*Method)()>
-                void bind(T* instance) {
-                    _callback = nullptr;
-                    _context.instance = static_cast<void*>(instance);
-                    _context.invoke = [](void* obj) {
-                        (static_cast<T*>(obj)->*Method)();
-                    };
+                inline void bind(decltype(nullptr)) {
+                    unbind();
                 }
 
                 inline void unbind() {
-                    _callback = nullptr;
-                    _context = {nullptr, nullptr};
+                    _invoke = nullptr;
                 }
 
                 [[nodiscard]] inline bool status() const {
-                    return (_callback != nullptr) || (_context.invoke && _context.instance);
+                    return _invoke != nullptr;
                 }
 
-                void invoke() const {
-                    if (_context.invoke && _context.instance) {
-                        _context.invoke(_context.instance);
-                        return;
-                    }
-                    if (_callback) {
-                        _callback();
-                        return;
+                R invoke(Args... args) const {
+                    if (_invoke) {
+                        return _invoke(_storage, args...);
                     }
                     #ifdef MIDILAR_EXCEPTIONS
                         throw std::runtime_error("Callback is not bound");
                     #endif
+                    return R();
                 }
 
             private:
-                CallbackType _callback;
-                CallbackContext _context = {nullptr, nullptr};
+                InvokerType _invoke;                                ///< Trampoline calling the target, nullptr when unbound.
+                alignas(_Alignment) unsigned char _storage[InlineSize]; ///< Function pointer, instance pointer or function object.
         };
-        
+
+        //////////////////////////////////////////////////////////////////////////////////////////////
+        /// \cond INTERNAL
+
+        /**
+         * @brief `CallbackHandler<R, void>` is the handler of callbacks without parameters.
+         */
+        template <typename R>
+        class CallbackHandler<R, void> : public CallbackHandler<R> {
+        };
+
         /// \endcond
 
     } // namespace MIDILAR::SystemCore
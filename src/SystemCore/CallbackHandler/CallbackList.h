@@ -0,0 +1,167 @@
+#ifndef MIDILAR_SYSTEM_CALLBACK_LIST_H
+#define MIDILAR_SYSTEM_CALLBACK_LIST_H
+
+    #include <MIDILAR_BuildSettings.h>
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #if __has_include(<atomic>)
+        #include <atomic>
+    #endif
+
+    namespace MIDILAR::SystemCore {
+
+        #if __has_include(<atomic>)
+            template <typename T>
+            using CallbackListAtomic = std::atomic<T>;
+        #else
+            /**
+             * @brief Plain stand-in for `std::atomic` on toolchains without `<atomic>`.
+             *
+             * Lists built on it are only safe when binding and invocation happen from the same
+             * execution context.
+             */
+            template <typename T>
+            struct CallbackListAtomic {
+                T _Value;
+
+                T load() const { return _Value; }
+                void store(T Value) { _Value = Value; }
+            };
+        #endif
+
+        //////////////////////////////////////////////////////////////////////////////////////////////
+        /**
+         * @brief Fixed-capacity list of callbacks invoked together, for fanning one event out to several targets.
+         *
+         * Where `CallbackHandler` holds a single target, `CallbackList` holds up to `Capacity` free
+         * functions and member functions, stored contiguously as invoker/target pairs. `invoke()`
+         * walks them in one loop and calls every bound target with the same arguments; return
+         * values are discarded.
+         *
+         * Binding and unbinding never allocate and may run on a control thread while a real-time
+         * thread invokes the list. A slot is only reused once the invocation that could still be
+         * reading it has returned, so a call never mixes the invoker of one target with the instance
+         * of another. A target unbound during an invocation may still receive that call: use
+         * `synchronize()` before destroying it. One thread binds and one thread invokes at a time.
+         *
+         * The list exposes `invoke` as a member function, so it can be bound wherever a single
+         * callback is expected:
+         * ```cpp
+         * CallbackList<4, void, const uint8_t*, size_t> outputs;
+         * outputs.bind<Recorder, &Recorder::Write>(&recorder);
+         * outputs.bind(&SendToUart);
+         *
+         * parser.BindChannelVoiceCallback<decltype(outputs), &decltype(outputs)::invoke>(&outputs);
+         * ```
+         *
+         * @tparam Capacity Maximum number of targets.
+         * @tparam R Return type of the callbacks.
+         * @tparam Args Parameter types of the callbacks; leave empty for callbacks without parameters.
+         */
+        template <size_t Capacity, typename R, typename... Args>
+        class CallbackList {
+
+            static_assert(Capacity > 0, "CallbackList needs room for at least one callback");
+
+            public:
+                using CallbackType = R (*)(Args...);
+
+            private:
+                struct _Slot;
+                using _Invoker = R (*)(const _Slot&, Args...);
+
+                struct _Slot {
+                    CallbackListAtomic<_Invoker> Invoke;        ///< Trampoline calling the target, nullptr when the slot is free.
+                    CallbackListAtomic<void*> Instance;         ///< Instance of a member function target.
+                    CallbackListAtomic<CallbackType> Function;  ///< Free function target.
+                    uint32_t Retired;                           ///< Value of `_Epoch` when the slot was freed. Binding thread only.
+                };
+
+                _Slot _Slots[Capacity];
+                CallbackListAtomic<size_t> _End;        ///< Slots past this index have never been used.
+                CallbackListAtomic<uint32_t> _Epoch;    ///< Incremented when an invocation starts and ends, odd while it runs.
+
+                static R _CallFunction(const _Slot& Slot, Args... args) {
+                    return Slot.Function.load()(args...);
+                }
+
+                template <typename T, R (T::*Method)(Args...)>
+                static R _CallMethod(const _Slot& Slot, Args... args) {
+                    return (static_cast<T*>(Slot.Instance.load())->*Method)(args...);
+                }
+
+                bool _Bind(_Invoker Invoke, void* Instance, CallbackType Function);
+                bool _Unbind(_Invoker Invoke, void* Instance, CallbackType Function);
+                void _Free(_Slot& Slot);
+
+            public:
+                CallbackList();
+
+                CallbackList(const CallbackList&) = delete;
+                CallbackList& operator=(const CallbackList&) = delete;
+
+                /**
+                 * @brief Adds a free function, static function or captureless lambda.
+                 * @return True if the function is bound, false if the list is full.
+                 */
+                bool bind(CallbackType Callback) {
+                    return (Callback != nullptr) && _Bind(&_CallFunction, nullptr, Callback);
+                }
+
+                /**
+                 * @brief Adds a member function called on `instance`.
+                 * @return True if the method is bound, false if the list is full.
+                 */
+                template <typename T, R (T::*Method)(Args...)>
+                bool bind(T* instance) {
+                    return (instance != nullptr) && _Bind(&_CallMethod<T, Method>, static_cast<void*>(instance), nullptr);
+                }
+
+                /**
+                 * @brief Removes a function bound with `bind(CallbackType)`.
+                 * @return True if the function was bound.
+                 */
+                bool unbind(CallbackType Callback) {
+                    return _Unbind(&_CallFunction, nullptr, Callback);
+                }
+
+                /**
+                 * @brief Removes a member function bound on `instance`.
+                 * @return True if the method was bound.
+                 */
+                template <typename T, R (T::*Method)(Args...)>
+                bool unbind(T* instance) {
+                    return _Unbind(&_CallMethod<T, Method>, static_cast<void*>(instance), nullptr);
+                }
+
+                /**
+                 * @brief Removes every target.
+                 */
+                void unbind();
+
+                /**
+                 * @brief Waits until the invocation running on another thread, if any, has returned.
+                 *
+                 * Once it returns, targets unbound before the call will not be invoked again.
+                 * Spins without blocking the invoking thread; never call it from a target.
+                 */
+                void synchronize() const;
+
+                [[nodiscard]] bool status() const { return size() > 0; }   ///< Returns true if at least one target is bound.
+                size_t size() const;                                        ///< Returns the number of bound targets.
+                static constexpr size_t capacity() { return Capacity; }     ///< Returns the maximum number of targets.
+
+                /**
+                 * @brief Calls every bound target, in binding order of their slots.
+                 *
+                 * Not reentrant: a target must not invoke the list that called it.
+                 */
+                void invoke(Args... args);
+        };
+
+    } // namespace MIDILAR::SystemCore
+
+    #include "CallbackList.tpp"
+
+#endif // MIDILAR_SYSTEM_CALLBACK_LIST_H
@@ -0,0 +1,120 @@
+#include "CallbackList.h"
+
+namespace MIDILAR::SystemCore {
+
+    template <size_t Capacity, typename R, typename... Args>
+    CallbackList<Capacity, R, Args...>::CallbackList() {
+        for (size_t i = 0; i < Capacity; i++) {
+            _Slots[i].Invoke.store(nullptr);
+            _Slots[i].Instance.store(nullptr);
+            _Slots[i].Function.store(nullptr);
+            _Slots[i].Retired = 0;
+        }
+        _End.store(0);
+        _Epoch.store(0);
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    bool CallbackList<Capacity, R, Args...>::_Bind(_Invoker Invoke, void* Instance, CallbackType Function) {
+        size_t end = _End.load();
+        uint32_t epoch = _Epoch.load();
+        _Slot* free = nullptr;
+
+        for (size_t i = 0; i < end; i++) {
+            _Slot& slot = _Slots[i];
+            _Invoker bound = slot.Invoke.load();
+            if (bound == Invoke && slot.Instance.load() == Instance && slot.Function.load() == Function) {
+                return true; // Already bound
+            }
+            // A slot freed during an invocation may still be read by it until that invocation ends
+            if (bound == nullptr && free == nullptr && ((slot.Retired & 1) == 0 || slot.Retired != epoch)) {
+                free = &slot;
+            }
+        }
+
+        bool append = (free == nullptr);
+        if (append) {
+            if (end == Capacity) {
+                return false;
+            }
+            free = &_Slots[end];
+        }
+
+        // Publish the target before the invoker, and the invoker before the slot becomes visible
+        free->Instance.store(Instance);
+        free->Function.store(Function);
+        free->Invoke.store(Invoke);
+        if (append) {
+            _End.store(end + 1);
+        }
+        return true;
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    bool CallbackList<Capacity, R, Args...>::_Unbind(_Invoker Invoke, void* Instance, CallbackType Function) {
+        size_t end = _End.load();
+        for (size_t i = 0; i < end; i++) {
+            _Slot& slot = _Slots[i];
+            if (slot.Invoke.load() == Invoke && slot.Instance.load() == Instance && slot.Function.load() == Function) {
+                _Free(slot);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    void CallbackList<Capacity, R, Args...>::_Free(_Slot& Slot) {
+        // The target fields are left in place for an invocation that already read the invoker
+        Slot.Invoke.store(nullptr);
+        Slot.Retired = _Epoch.load();
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    void CallbackList<Capacity, R, Args...>::unbind() {
+        size_t end = _End.load();
+        for (size_t i = 0; i < end; i++) {
+            if (_Slots[i].Invoke.load() != nullptr) {
+                _Free(_Slots[i]);
+            }
+        }
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    void CallbackList<Capacity, R, Args...>::synchronize() const {
+        uint32_t epoch = _Epoch.load();
+        if ((epoch & 1) == 0) {
+            return;
+        }
+        while (_Epoch.load() == epoch) {
+        }
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    size_t CallbackList<Capacity, R, Args...>::size() const {
+        size_t end = _End.load();
+        size_t count = 0;
+        for (size_t i = 0; i < end; i++) {
+            count += (_Slots[i].Invoke.load() != nullptr);
+        }
+        return count;
+    }
+
+    template <size_t Capacity, typename R, typename... Args>
+    void CallbackList<Capacity, R, Args...>::invoke(Args... args) {
+        // Only this thread writes the epoch: a load and a store are enough to advance it
+        uint32_t epoch = _Epoch.load();
+        _Epoch.store(epoch + 1);
+
+        size_t end = _End.load();
+        for (size_t i = 0; i < end; i++) {
+            _Invoker call = _Slots[i].Invoke.load();
+            if (call != nullptr) {
+                call(_Slots[i], args...);
+            }
+        }
+
+        _Epoch.store(epoch + 2);
+    }
+
+}
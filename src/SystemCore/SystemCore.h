@@ -24,5 +24,12 @@
         #endif
         #include <SystemCore/RingBuffer/RingBuffer.h>
     #endif
+
+    #if __has_include(<SystemCore/BlockPool/BlockPool.h>)
+        #ifndef MIDILAR_SYSTEM_BLOCK_POOL
+            #define MIDILAR_SYSTEM_BLOCK_POOL
+        #endif
+        #include <SystemCore/BlockPool/BlockPool.h>
+    #endif
     
 #endif//MIDILAR_SYSTEM_CORE_H
\ No newline at end of file
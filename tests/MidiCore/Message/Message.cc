@@ -208,6 +208,88 @@ namespace MIDILAR::MidiCore {
         #endif
     //
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Inline Storage Tests
+
+        TEST(MidiMessageTest, ShortMessagesStayInline) {
+            Message msg;
+            EXPECT_TRUE(msg.IsInline());
+
+            msg.NoteOn(60, 100, 1);
+            EXPECT_TRUE(msg.IsInline());
+            EXPECT_EQ(msg.Data(0), 0x91);
+
+            msg.TimingTick();
+            EXPECT_TRUE(msg.IsInline());
+            EXPECT_EQ(msg.size(), 1);
+
+            msg.MTC_FullFrame(1, 2, 3, 4, 0);
+            EXPECT_TRUE(msg.IsInline());
+            EXPECT_EQ(msg.size(), 8);
+        }
+
+        TEST(MidiMessageTest, LongMessagesSpillToHeap) {
+            uint8_t payload[Message::InlineCapacity + 4];
+            for (size_t i = 0; i < sizeof(payload); ++i) {
+                payload[i] = static_cast<uint8_t>(i & 0x7F);
+            }
+
+            Message msg;
+            msg.NoteOn(60, 100, 1);
+            msg.SystemExclusive(payload, sizeof(payload));
+
+            EXPECT_FALSE(msg.IsInline());
+            ASSERT_EQ(msg.size(), sizeof(payload) + 2);
+            EXPECT_EQ(msg.Data(0), MIDI_SYSEX_START);
+            EXPECT_EQ(memcmp(msg.Buffer() + 1, payload, sizeof(payload)), 0);
+            EXPECT_EQ(msg.Data(msg.size() - 1), MIDI_SYSEX_END);
+
+            // Heap storage is reused once allocated
+            msg.NoteOff(60, 0, 2);
+            EXPECT_EQ(msg.size(), 3);
+            EXPECT_EQ(msg.Data(0), 0x82);
+        }
+
+        TEST(MidiMessageTest, CopyAcrossStorageModes) {
+            uint8_t payload[Message::InlineCapacity + 4] = {};
+            Message heap;
+            heap.SystemExclusive(payload, sizeof(payload));
+
+            Message copy(heap);
+            EXPECT_FALSE(copy.IsInline());
+            EXPECT_EQ(copy.size(), heap.size());
+            EXPECT_EQ(memcmp(copy.Buffer(), heap.Buffer(), heap.size()), 0);
+
+            Message small;
+            small.ControlChange(7, 100, 3);
+            heap = small;
+            EXPECT_EQ(heap.size(), 3);
+            EXPECT_EQ(heap.Data(0), 0xB3);
+
+            Message fresh(small);
+            EXPECT_TRUE(fresh.IsInline());
+            EXPECT_EQ(memcmp(fresh.Buffer(), small.Buffer(), 3), 0);
+        }
+
+        TEST(MidiMessageTest, MoveLeavesSourceEmpty) {
+            uint8_t payload[Message::InlineCapacity + 4] = {};
+            Message heap;
+            heap.SystemExclusive(payload, sizeof(payload));
+            const uint8_t* storage = heap.Buffer();
+
+            Message moved(std::move(heap));
+            EXPECT_EQ(moved.Buffer(), storage); // Heap storage is transferred, not copied
+            EXPECT_EQ(heap.size(), 0);
+            EXPECT_TRUE(heap.IsInline());
+
+            Message small;
+            small.ProgramChange(5, 0);
+            Message target(std::move(small));
+            EXPECT_EQ(target.size(), 2);
+            EXPECT_EQ(target.Data(1), 5);
+            EXPECT_EQ(small.size(), 0);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Vector API Tests
 
         TEST(MidiMessageTest, VectorReturnsCorrectBuffer) {
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Message/Message.h>
+#include <vector>
+
+#if defined(MIDILAR_MESSAGE_POOL)
+    #include <MidiCore/Message/MessagePool.h>
+
+namespace MIDILAR::MidiCore {
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Allocation
+
+        TEST(MessagePool, ServesSmallestFittingClass) {
+            size_t capacity = 0;
+
+            uint8_t* block = MessagePool::Allocate(10, capacity);
+            ASSERT_NE(block, nullptr);
+            EXPECT_EQ(capacity, 16u);
+            EXPECT_EQ(MessagePool::GetStatistics(0).InUse, 1u);
+            EXPECT_TRUE(MessagePool::Deallocate(block));
+
+            block = MessagePool::Allocate(200, capacity);
+            ASSERT_NE(block, nullptr);
+            EXPECT_EQ(capacity, 256u);
+            EXPECT_TRUE(MessagePool::Deallocate(block));
+
+            EXPECT_EQ(MessagePool::Allocate(MessagePool::MaxBlockSize + 1, capacity), nullptr);
+        }
+
+        TEST(MessagePool, FallsBackToLargerClassWhenExhausted) {
+            MessagePool::ResetStatistics();
+            MessagePool::Statistics small = MessagePool::GetStatistics(0);
+
+            std::vector<uint8_t*> blocks;
+            size_t capacity = 0;
+            for (size_t i = 0; i < small.BlockCount; i++) {
+                blocks.push_back(MessagePool::Allocate(10, capacity));
+                ASSERT_EQ(capacity, 16u);
+            }
+
+            uint8_t* spill = MessagePool::Allocate(10, capacity);
+            ASSERT_NE(spill, nullptr);
+            EXPECT_EQ(capacity, 64u);
+            EXPECT_EQ(MessagePool::GetStatistics(0).FailedAllocations, 1u);
+            EXPECT_EQ(MessagePool::GetStatistics(0).HighWaterMark, small.BlockCount);
+
+            MessagePool::Deallocate(spill);
+            for (uint8_t* block : blocks) {
+                EXPECT_TRUE(MessagePool::Deallocate(block));
+            }
+            EXPECT_EQ(MessagePool::GetStatistics(0).InUse, 0u);
+        }
+
+        TEST(MessagePool, RejectsForeignPointers) {
+            uint8_t local[16];
+            EXPECT_FALSE(MessagePool::Deallocate(local));
+            EXPECT_EQ(MessagePool::GetStatistics(MessagePool::ClassCount).BlockSize, 0u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Message/MessageView.h>
+#include <MidiCore/Protocol/Defines.h>
+#include <MidiCore/Protocol/StatusTable.h>
+#include <vector>
+#include <cstdint>
+
+#if __has_include(<MidiCore/MessageParser/MessageParser.h>)
+    #include <MidiCore/MessageParser/MessageParser.h>
+#endif
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Status Table Tests
+
+        static_assert(MidiProtocol::StatusTable[0x45].Kind == MidiProtocol::MessageKind::Data, "data byte");
+        static_assert(MidiProtocol::StatusTable[0x93].Kind == MidiProtocol::MessageKind::NoteOn, "note on");
+        static_assert(MidiProtocol::StatusTable[0xC5].Size == 2, "program change size");
+        static_assert(MidiProtocol::StatusTable[0xF8].Category == MidiProtocol::MessageCategory::RealTime, "real time");
+
+        TEST(MessageViewTest, StatusTableMatchesClassifier) {
+            for (unsigned int i = 0; i < 256; i++) {
+                MidiProtocol::StatusInfo info = MidiProtocol::ClassifyStatus(static_cast<uint8_t>(i));
+                EXPECT_EQ(MidiProtocol::StatusTable[static_cast<uint8_t>(i)].Kind, info.Kind);
+                EXPECT_EQ(MidiProtocol::StatusTable[static_cast<uint8_t>(i)].Size, info.Size);
+            }
+            EXPECT_EQ(MidiProtocol::StatusTable[0xF4].Kind, MidiProtocol::MessageKind::Undefined);
+            EXPECT_EQ(MidiProtocol::StatusTable[0xF0].Category, MidiProtocol::MessageCategory::SystemExclusive);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Accessor Tests
+
+        TEST(MessageViewTest, NoteAccessors) {
+            Message msg;
+            msg.NoteOn(61, 99, 7);
+            MessageView view(msg);
+
+            EXPECT_EQ(view.Kind(), MidiProtocol::MessageKind::NoteOn);
+            EXPECT_TRUE(view.IsChannelVoice());
+            EXPECT_EQ(view.Channel(), 7);
+            EXPECT_EQ(view.Note(), 61);
+            EXPECT_EQ(view.Velocity(), 99);
+        }
+
+        TEST(MessageViewTest, ControlAndPressureAccessors) {
+            uint8_t cc[] = {MIDI_CONTROL_CHANGE | 2, 74, 33};
+            uint8_t cp[] = {MIDI_CHANNEL_PRESSURE | 1, 50};
+            uint8_t at[] = {MIDI_AFTER_TOUCH, 60, 40};
+
+            EXPECT_EQ(MessageView(cc, 3).Controller(), 74);
+            EXPECT_EQ(MessageView(cc, 3).ControllerValue(), 33);
+            EXPECT_EQ(MessageView(cp, 2).Pressure(), 50);
+            EXPECT_EQ(MessageView(at, 3).Pressure(), 40);
+            EXPECT_EQ(MessageView(cp, 2).Velocity(), 0); // Missing field reads as 0
+        }
+
+        TEST(MessageViewTest, PitchBend14) {
+            Message msg;
+
+            EXPECT_EQ(MessageView(msg.PitchBend(static_cast<uint16_t>(0x2ABC))).PitchBend14(), 0x2ABC);
+            EXPECT_EQ(MessageView(msg.PitchBend(static_cast<int16_t>(0))).PitchBend14(), 8192);
+        }
+
+        TEST(MessageViewTest, SystemAccessors) {
+            Message msg;
+            uint8_t payload[] = {0x7D, 0x01, 0x02};
+
+            MessageView spp(msg.SongPositionPointer(1234));
+            EXPECT_EQ(spp.Kind(), MidiProtocol::MessageKind::SongPositionPointer);
+            EXPECT_EQ(spp.SongPosition(), 1234);
+            EXPECT_EQ(spp.Channel(), 0);
+
+            msg.SystemExclusive(payload, 3);
+            MessageView sysex(msg);
+            EXPECT_TRUE(sysex.IsSysEx());
+            ASSERT_EQ(sysex.SysExPayloadSize(), 3u);
+            EXPECT_EQ(sysex.SysExPayload()[0], 0x7D);
+            EXPECT_EQ(sysex.SysExPayload()[2], 0x02);
+
+            EXPECT_EQ(MessageView(msg.Stop()).SysExPayload(), nullptr);
+        }
+
+        TEST(MessageViewTest, EmptyView) {
+            MessageView view;
+
+            EXPECT_TRUE(view.empty());
+            EXPECT_EQ(view.Kind(), MidiProtocol::MessageKind::Data);
+            EXPECT_EQ(view.Category(), MidiProtocol::MessageCategory::None);
+            EXPECT_EQ(view.Note(), 0);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Parser Integration Tests
+
+    #if __has_include(<MidiCore/MessageParser/MessageParser.h>)
+        std::vector<uint8_t> g_Notes;
+        size_t g_RawCalls = 0;
+
+        void NoteViewCallback(const MessageView& view) {
+            g_Notes.push_back(view.Note());
+        }
+
+        void RawCallback(const uint8_t*, size_t) {
+            g_RawCalls++;
+        }
+
+        TEST(MessageViewTest, ParserDispatchesViews) {
+            MessageParser parser;
+            uint8_t stream[] = {MIDI_NOTE_ON, 60, 100, MIDI_NOTE_OFF, 62, 0};
+
+            g_Notes.clear();
+            parser.BindChannelVoiceCallback(NoteViewCallback);
+            parser.ProcessData(stream, sizeof(stream));
+
+            ASSERT_EQ(g_Notes.size(), 2u);
+            EXPECT_EQ(g_Notes[0], 60);
+            EXPECT_EQ(g_Notes[1], 62);
+        }
+
+        TEST(MessageViewTest, BindingReplacesOtherForm) {
+            MessageParser parser;
+            uint8_t stream[] = {MIDI_NOTE_ON, 60, 100};
+
+            g_Notes.clear();
+            g_RawCalls = 0;
+            parser.BindChannelVoiceCallback(NoteViewCallback);
+            parser.BindChannelVoiceCallback(RawCallback);
+            parser.ProcessData(stream, sizeof(stream));
+
+            EXPECT_EQ(g_RawCalls, 1u);
+            EXPECT_TRUE(g_Notes.empty());
+        }
+    #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Message/Message.h>
+#include <MidiCore/Message/ParameterNumberEncoder.h>
+#include <MidiCore/Protocol/Defines.h>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<uint8_t> Bytes(const Message& msg) {
+            return std::vector<uint8_t>(msg.Buffer(), msg.Buffer() + msg.size());
+        }
+
+        std::vector<uint8_t> Bytes(const uint8_t* data, size_t size) {
+            return std::vector<uint8_t>(data, data + size);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Message Builder Tests
+
+        TEST(ParameterNumberTest, MessageNRPN14BitUsesRunningStatus) {
+            Message msg;
+            msg.CC_NRPN(static_cast<uint16_t>(0x0123), static_cast<uint16_t>(0x2ABC), 3);
+
+            std::vector<uint8_t> expected = {
+                MIDI_CONTROL_CHANGE | 3,
+                MIDI_NRPN_MSB, 0x02, MIDI_NRPN_LSB, 0x23,
+                MIDI_DATA_ENTRY_MSB, 0x55, MIDI_DATA_ENTRY_LSB, 0x3C
+            };
+            EXPECT_EQ(Bytes(msg), expected);
+        }
+
+        TEST(ParameterNumberTest, MessageNRPN7Bit) {
+            Message msg;
+            msg.CC_NRPN(static_cast<uint16_t>(0x3FFF), static_cast<uint8_t>(200));
+
+            std::vector<uint8_t> expected = {
+                MIDI_CONTROL_CHANGE, MIDI_NRPN_MSB, 0x7F, MIDI_NRPN_LSB, 0x7F, MIDI_DATA_ENTRY_MSB, 0x7F
+            };
+            EXPECT_EQ(Bytes(msg), expected);
+        }
+
+        TEST(ParameterNumberTest, MessageRPN) {
+            Message msg;
+            msg.CC_RPN(static_cast<uint16_t>(0x0000), static_cast<uint16_t>(2 << 7), 1); // Pitch bend range, 2 semitones
+
+            std::vector<uint8_t> expected = {
+                MIDI_CONTROL_CHANGE | 1,
+                MIDI_RPN_MSB, 0x00, MIDI_RPN_LSB, 0x00,
+                MIDI_DATA_ENTRY_MSB, 0x02, MIDI_DATA_ENTRY_LSB, 0x00
+            };
+            EXPECT_EQ(Bytes(msg), expected);
+        }
+
+        TEST(ParameterNumberTest, MessageDataIncrementDecrement) {
+            Message msg;
+
+            EXPECT_EQ(Bytes(msg.CC_NRPN_DataIncrement(2)), (std::vector<uint8_t>{MIDI_CONTROL_CHANGE | 2, MIDI_NRPN_DATA_INCREMENT, 0x00}));
+            EXPECT_EQ(Bytes(msg.CC_NRPN_DataDecrement(20)), (std::vector<uint8_t>{MIDI_CONTROL_CHANGE | 15, MIDI_NRPN_DATA_DECREMENT, 0x00}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Stateful Encoder Tests
+
+        TEST(ParameterNumberTest, EncoderSkipsUnchangedParameter) {
+            ParameterNumberEncoder encoder;
+            uint8_t out[ParameterNumberEncoder::MaxSize];
+
+            EXPECT_EQ(encoder.NRPN(out, 0x0123, 100), 9u);
+
+            size_t size = encoder.NRPN(out, 0x0123, 200);
+            EXPECT_EQ(Bytes(out, size), (std::vector<uint8_t>{MIDI_DATA_ENTRY_MSB, 0x01, MIDI_DATA_ENTRY_LSB, 0x48}));
+
+            EXPECT_EQ(encoder.NRPNCoarse(out, 0x0123, 5), 2u);
+        }
+
+        TEST(ParameterNumberTest, EncoderReselectsOnChange) {
+            ParameterNumberEncoder encoder;
+            uint8_t out[ParameterNumberEncoder::MaxSize];
+
+            encoder.NRPN(out, 0x0123, 100);
+
+            EXPECT_EQ(encoder.NRPN(out, 0x0124, 100), 8u);    // New parameter, running status kept
+            EXPECT_EQ(encoder.RPN(out, 0x0124, 100), 8u);     // Same number in the RPN space is a different parameter
+            EXPECT_EQ(encoder.RPN(out, 0x0124, 100, 1), 9u);  // Different channel needs a new status byte
+            EXPECT_EQ(encoder.RPN(out, 0x0124, 100), 5u);     // Channel 0 still has the parameter selected
+        }
+
+        TEST(ParameterNumberTest, EncoderInvalidateAndReset) {
+            ParameterNumberEncoder encoder;
+            uint8_t out[ParameterNumberEncoder::MaxSize];
+
+            encoder.NRPN(out, 7, 100);
+            encoder.InvalidateRunningStatus();
+            EXPECT_EQ(encoder.NRPN(out, 7, 100), 5u);
+            EXPECT_EQ(out[0], MIDI_CONTROL_CHANGE);
+
+            encoder.Reset();
+            EXPECT_EQ(encoder.NRPN(out, 7, 100), 9u);
+        }
+
+        TEST(ParameterNumberTest, EncoderDataStep) {
+            ParameterNumberEncoder encoder;
+            uint8_t out[ParameterNumberEncoder::MaxSize];
+
+            EXPECT_EQ(encoder.DataIncrement(out), 3u);
+            EXPECT_EQ(Bytes(out, encoder.DataDecrement(out)), (std::vector<uint8_t>{MIDI_NRPN_DATA_DECREMENT, 0x00}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Message/ShortMessage.h>
+#include <MidiCore/Protocol/Defines.h>
+#if __has_include(<SystemCore/RingBuffer/RingBuffer.h>)
+    #include <SystemCore/RingBuffer/RingBuffer.h>
+#endif
+#include <type_traits>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compile Time Checks
+
+        static_assert(std::is_trivially_copyable<ShortMessage>::value, "ShortMessage must be trivially copyable");
+        static_assert(sizeof(ShortMessage) == sizeof(uint32_t), "ShortMessage must pack into 32 bits");
+        static_assert(!std::is_convertible<uint8_t, ShortMessage>::value, "A lone status byte must not convert to a ShortMessage");
+
+        static_assert(ShortMessage::NoteOn(60, 100, 2).Packed() == ShortMessage::Pack(MIDI_NOTE_ON | 2, 60, 100, 3), "constexpr NoteOn");
+        static_assert(ShortMessage::ProgramChange(5).size() == 2, "constexpr ProgramChange");
+        static_assert(ShortMessage::TimingTick().size() == 1, "constexpr TimingTick");
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Builder Tests
+
+        TEST(ShortMessageTest, MatchesMessageBuilders) {
+            Message msg;
+
+            EXPECT_EQ(ShortMessage::NoteOn(200, 200, 20), ShortMessage(msg.NoteOn(200, 200, 20)));
+            EXPECT_EQ(ShortMessage::NoteOff(64, 10, 3), ShortMessage(msg.NoteOff(64, 10, 3)));
+            EXPECT_EQ(ShortMessage::AfterTouch(64, 10, 3), ShortMessage(msg.AfterTouch(64, 10, 3)));
+            EXPECT_EQ(ShortMessage::ProgramChange(12, 4), ShortMessage(msg.ProgramChange(12, 4)));
+            EXPECT_EQ(ShortMessage::ChannelPressure(90, 4), ShortMessage(msg.ChannelPressure(90, 4)));
+            EXPECT_EQ(ShortMessage::ControlChange(7, 100, 1), ShortMessage(msg.ControlChange(7, 100, 1)));
+            EXPECT_EQ(ShortMessage::CC_Volume(100, 1), ShortMessage(msg.CC_Volume(100, 1)));
+            EXPECT_EQ(ShortMessage::CC_LocalControlOff(5), ShortMessage(msg.CC_LocalControlOff(5)));
+            EXPECT_EQ(ShortMessage::CC_OmniOn(5), ShortMessage(msg.CC_OmniOn(5)));
+            EXPECT_EQ(ShortMessage::CC_Mono(5), ShortMessage(msg.CC_Mono(5)));
+            EXPECT_EQ(ShortMessage::SongPositionPointer(1000), ShortMessage(msg.SongPositionPointer(1000)));
+            EXPECT_EQ(ShortMessage::MTC_QuarterFrame(3, 9), ShortMessage(msg.MTC_QuarterFrame(3, 9)));
+            EXPECT_EQ(ShortMessage::Start(), ShortMessage(msg.Start()));
+        }
+
+        TEST(ShortMessageTest, PitchBendMatchesMessage) {
+            Message msg;
+
+            for (int v = -8192; v <= 8191; v += 257) {
+                EXPECT_EQ(ShortMessage::PitchBend(static_cast<int16_t>(v), 2), ShortMessage(msg.PitchBend(static_cast<int16_t>(v), 2)));
+            }
+            for (int v = -64; v <= 63; v++) {
+                EXPECT_EQ(ShortMessage::PitchBend(static_cast<int8_t>(v), 2), ShortMessage(msg.PitchBend(static_cast<int8_t>(v), 2)));
+            }
+            EXPECT_EQ(ShortMessage::PitchBend(static_cast<uint16_t>(0xFFFF)), ShortMessage(msg.PitchBend(static_cast<uint16_t>(0xFFFF))));
+            EXPECT_EQ(ShortMessage::PitchBend(static_cast<uint8_t>(127)), ShortMessage(msg.PitchBend(static_cast<uint8_t>(127))));
+        }
+
+        TEST(ShortMessageTest, InvalidChannelModeIsEmpty) {
+            EXPECT_EQ(ShortMessage::CC_OmniMode(static_cast<uint8_t>(0x10), 0).size(), 0u);
+            EXPECT_EQ(ShortMessage::CC_Polyphony(static_cast<uint8_t>(0x10), 0).size(), 0u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Conversion Tests
+
+        TEST(ShortMessageTest, ConvertsToMessage) {
+            Message msg = ShortMessage::ControlChange(10, 64, 9);
+
+            ASSERT_EQ(msg.size(), 3u);
+            EXPECT_EQ(msg.Data(0), MIDI_CONTROL_CHANGE | 9);
+            EXPECT_EQ(msg.Data(1), 10);
+            EXPECT_EQ(msg.Data(2), 64);
+        }
+
+        TEST(ShortMessageTest, SysExConvertsToEmpty) {
+            uint8_t payload[] = {0x01, 0x02, 0x03};
+            Message msg;
+            msg.SystemExclusive(payload, sizeof(payload));
+
+            ShortMessage s = msg;
+            EXPECT_EQ(s.size(), 0u);
+            EXPECT_EQ(s.Packed(), 0u);
+        }
+
+        TEST(ShortMessageTest, DataAccess) {
+            ShortMessage s = ShortMessage::ProgramChange(33, 7);
+
+            EXPECT_EQ(s.Command(), MIDI_PROGRAM_CHANGE);
+            EXPECT_EQ(s.Channel(), 7);
+            EXPECT_EQ(s.Data(1), 33);
+            EXPECT_EQ(s.Data(2), 0);
+            EXPECT_EQ(ShortMessage::FromPacked(s.Packed()), s);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RingBuffer Tests
+    #if __has_include(<SystemCore/RingBuffer/RingBuffer.h>)
+
+        TEST(ShortMessageTest, RingBufferElement) {
+            ShortMessage storage[4];
+            SystemCore::RingBuffer<ShortMessage> queue(storage, 4);
+
+            ASSERT_TRUE(queue.Push(ShortMessage::NoteOn(60, 100)));
+            ASSERT_TRUE(queue.Push(ShortMessage::NoteOff(60)));
+
+            ShortMessage out;
+            ASSERT_TRUE(queue.Pop(out));
+            EXPECT_EQ(out, ShortMessage::NoteOn(60, 100));
+            ASSERT_TRUE(queue.Pop(out));
+            EXPECT_EQ(out, ShortMessage::NoteOff(60));
+        }
+    #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
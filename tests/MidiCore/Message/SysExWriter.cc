@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Message/Message.h>
+#include <MidiCore/Message/SysExWriter.h>
+#include <MidiCore/Protocol/Defines.h>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+
+#if __has_include(<MidiCore/DeviceBase/DeviceBase.h>)
+    #include <MidiCore/DeviceBase/DeviceBase.h>
+#endif
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<std::vector<uint8_t>> g_Chunks;
+
+        void CollectChunk(const uint8_t* data, size_t size) {
+            g_Chunks.emplace_back(data, data + size);
+        }
+
+        std::vector<uint8_t> Payload(size_t size) {
+            std::vector<uint8_t> payload(size);
+            for (size_t i = 0; i < size; i++) {
+                payload[i] = static_cast<uint8_t>(i & 0x7F);
+            }
+            return payload;
+        }
+
+        std::vector<uint8_t> Joined() {
+            std::vector<uint8_t> joined;
+            for (const std::vector<uint8_t>& chunk : g_Chunks) {
+                joined.insert(joined.end(), chunk.begin(), chunk.end());
+            }
+            return joined;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Message SysEx Tests
+
+        TEST(SysExTest, LongSystemExclusiveIsNotTruncated) {
+            std::vector<uint8_t> payload = Payload(1000);
+            Message msg;
+
+            msg.SystemExclusive(payload.data(), payload.size());
+            ASSERT_EQ(msg.size(), 1002u);
+            EXPECT_EQ(msg.Data(0), MIDI_SYSEX_START);
+            EXPECT_EQ(msg.Data(500), payload[499]);
+            EXPECT_EQ(msg.Data(1001), MIDI_SYSEX_END);
+
+            msg.SystemExclusive(payload);
+            EXPECT_EQ(msg.size(), 1002u);
+        }
+
+        TEST(SysExTest, ChunkedMessageConstruction) {
+            std::vector<uint8_t> payload = Payload(700);
+            Message msg;
+
+            msg.BeginSysEx(payload.size() + 2);
+            for (size_t i = 0; i < payload.size(); i += 100) {
+                msg.Append(payload.data() + i, 100);
+            }
+            msg.EndSysEx();
+
+            Message expected;
+            expected.SystemExclusive(payload.data(), payload.size());
+            ASSERT_EQ(msg.size(), expected.size());
+            EXPECT_EQ(memcmp(msg.Buffer(), expected.Buffer(), msg.size()), 0);
+
+            msg.EndSysEx(); // Already closed
+            EXPECT_EQ(msg.size(), expected.size());
+        }
+
+        TEST(SysExTest, EndSysExIgnoresOtherMessages) {
+            Message msg;
+            msg.NoteOn(60, 100);
+            msg.EndSysEx();
+            EXPECT_EQ(msg.size(), 3u);
+        }
+
+        TEST(SysExTest, ReserveKeepsContent) {
+            Message msg;
+            msg.NoteOn(60, 100);
+
+            EXPECT_TRUE(msg.Reserve(4096));
+            ASSERT_EQ(msg.size(), 3u);
+            EXPECT_EQ(msg.Data(1), 60);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SysExWriter Tests
+
+        TEST(SysExTest, WriterSplitsIntoFixedChunks) {
+            std::vector<uint8_t> payload = Payload(100);
+            uint8_t chunk[16];
+            SysExWriter writer(chunk, sizeof(chunk));
+            writer.BindOutput(CollectChunk);
+
+            g_Chunks.clear();
+            EXPECT_TRUE(writer.Write(payload.data(), payload.size()));
+
+            ASSERT_EQ(g_Chunks.size(), 7u); // 102 bytes in chunks of 16
+            for (size_t i = 0; i + 1 < g_Chunks.size(); i++) {
+                EXPECT_EQ(g_Chunks[i].size(), 16u);
+            }
+
+            std::vector<uint8_t> joined = Joined();
+            ASSERT_EQ(joined.size(), 102u);
+            EXPECT_EQ(joined.front(), MIDI_SYSEX_START);
+            EXPECT_EQ(joined.back(), MIDI_SYSEX_END);
+            EXPECT_TRUE(std::equal(payload.begin(), payload.end(), joined.begin() + 1));
+        }
+
+        TEST(SysExTest, WriterStreamsAcrossAppends) {
+            std::vector<uint8_t> payload = Payload(50);
+            uint8_t chunk[8];
+            SysExWriter writer(chunk, sizeof(chunk));
+            writer.BindOutput(CollectChunk);
+
+            g_Chunks.clear();
+            EXPECT_FALSE(writer.Append(payload.data(), 1)); // Not open
+
+            writer.Begin();
+            EXPECT_TRUE(writer.IsOpen());
+            for (size_t i = 0; i < payload.size(); i += 5) {
+                writer.Append(payload.data() + i, 5);
+            }
+            writer.End();
+            EXPECT_FALSE(writer.IsOpen());
+
+            EXPECT_EQ(Joined().size(), 52u);
+        }
+
+    #if __has_include(<MidiCore/DeviceBase/DeviceBase.h>)
+        class SysExDevice : public DeviceBase {
+        public:
+            using DeviceBase::MidiOutputSysEx;
+        };
+
+        TEST(SysExTest, DeviceStreamsSysEx) {
+            std::vector<uint8_t> payload = Payload(1000);
+            SysExDevice device;
+            device.BindMidiOut(CollectChunk);
+
+            g_Chunks.clear();
+            device.MidiOutputSysEx(payload.data(), payload.size());
+
+            EXPECT_EQ(g_Chunks.size(), (1002u + MIDILAR_DEVICE_SYSEX_CHUNK_SIZE - 1) / MIDILAR_DEVICE_SYSEX_CHUNK_SIZE);
+            std::vector<uint8_t> joined = Joined();
+            ASSERT_EQ(joined.size(), 1002u);
+            EXPECT_EQ(joined.back(), MIDI_SYSEX_END);
+        }
+    #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MessageBatch/MessageBatch.h>
+#include <MidiCore/Protocol/Defines.h>
+#include <vector>
+#include <cstdint>
+
+#if __has_include(<MidiCore/MessageParser/MessageParser.h>)
+    #include <MidiCore/MessageParser/MessageParser.h>
+#endif
+
+#if __has_include(<MidiCore/DeviceBase/DeviceBase.h>)
+    #include <MidiCore/DeviceBase/DeviceBase.h>
+#endif
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<std::vector<uint8_t>> g_Received;
+
+        void Collect(const uint8_t* data, size_t size) {
+            g_Received.emplace_back(data, data + size);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Construction Tests
+
+        TEST(MessageBatchTest, DefaultIsEmpty) {
+            MessageBatch batch;
+
+            EXPECT_TRUE(batch.empty());
+            EXPECT_EQ(batch.size(), 0u);
+            EXPECT_EQ(batch.ByteSize(), 0u);
+            EXPECT_EQ(batch.Buffer(), nullptr);
+            EXPECT_TRUE(batch.begin() == batch.end());
+        }
+
+        TEST(MessageBatchTest, BuildersMatchMessage) {
+            MessageBatch batch;
+            batch.NoteOn(60, 100, 1).ControlChange(7, 90, 1).ProgramChange(3, 2).TimingTick().SongPositionPointer(300);
+
+            Message msg;
+            std::vector<Message> expected = {
+                Message(msg.NoteOn(60, 100, 1)),
+                Message(msg.ControlChange(7, 90, 1)),
+                Message(msg.ProgramChange(3, 2)),
+                Message(msg.TimingTick()),
+                Message(msg.SongPositionPointer(300)),
+            };
+
+            ASSERT_EQ(batch.size(), expected.size());
+            EXPECT_EQ(batch.ByteSize(), 3u + 3u + 2u + 1u + 3u);
+
+            size_t i = 0;
+            for (MessageBatch::View view : batch) {
+                ASSERT_EQ(view.size(), expected[i].size());
+                for (size_t j = 0; j < view.size(); j++) {
+                    EXPECT_EQ(view.Data(j), expected[i].Data(j));
+                }
+                i++;
+            }
+            EXPECT_EQ(i, expected.size());
+        }
+
+        TEST(MessageBatchTest, AppendOverloads) {
+            MessageBatch batch;
+            uint8_t raw[] = {MIDI_NOTE_OFF, 60, 0};
+            Message msg;
+            msg.NoteOn(64, 10);
+
+            EXPECT_TRUE(batch.Append(raw, sizeof(raw)));
+            EXPECT_TRUE(batch.Append(msg));
+            EXPECT_TRUE(batch.Append(ShortMessage::CC_Volume(90, 3)));
+            EXPECT_FALSE(batch.Append(raw, 0));
+            EXPECT_FALSE(batch.Append(ShortMessage()));
+
+            ASSERT_EQ(batch.size(), 3u);
+            EXPECT_EQ(batch[1].Data(1), 64);
+            EXPECT_EQ(batch[2].Data(0), MIDI_CONTROL_CHANGE | 3);
+            EXPECT_EQ(batch[3].size(), 0u);
+        }
+
+        TEST(MessageBatchTest, SystemExclusiveAddsFraming) {
+            MessageBatch batch;
+            std::vector<uint8_t> payload(300, 0x11);
+
+            batch.SystemExclusive(payload.data(), payload.size());
+
+            ASSERT_EQ(batch.size(), 1u);
+            ASSERT_EQ(batch[0].size(), payload.size() + 2);
+            EXPECT_EQ(batch[0].Data(0), MIDI_SYSEX_START);
+            EXPECT_EQ(batch[0].Data(payload.size() + 1), MIDI_SYSEX_END);
+        }
+
+        TEST(MessageBatchTest, GrowsAndClears) {
+            MessageBatch batch;
+
+            for (int i = 0; i < 10000; i++) {
+                batch.NoteOn(static_cast<uint8_t>(i % 128), 100);
+            }
+            ASSERT_EQ(batch.size(), 10000u);
+            EXPECT_EQ(batch.ByteSize(), 30000u);
+            EXPECT_EQ(batch[9999].Data(1), 9999 % 128);
+
+            const uint8_t* arena = batch.Buffer();
+            batch.Clear();
+            EXPECT_TRUE(batch.empty());
+
+            batch.NoteOff(1);
+            EXPECT_EQ(batch.Buffer(), arena); // Storage is reused
+        }
+
+        TEST(MessageBatchTest, CopyAndMove) {
+            MessageBatch batch;
+            batch.NoteOn(60, 100).Start();
+
+            MessageBatch copy(batch);
+            ASSERT_EQ(copy.size(), 2u);
+            EXPECT_NE(copy.Buffer(), batch.Buffer());
+            EXPECT_EQ(copy[1].Data(0), MIDI_REALTIME_START);
+
+            MessageBatch moved(std::move(batch));
+            EXPECT_EQ(moved.size(), 2u);
+            EXPECT_TRUE(batch.empty());
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Integration Tests
+
+    #if __has_include(<MidiCore/MessageParser/MessageParser.h>)
+        TEST(MessageBatchTest, ParserProcessesWholeBatch) {
+            MessageBatch batch;
+            uint8_t sysex[] = {0x7D, 0x01, 0x02};
+            batch.NoteOn(60, 100).ControlChange(1, 64).SystemExclusive(sysex, sizeof(sysex)).Stop();
+
+            MessageParser parser(16);
+            parser.BindDefaultCallback(Collect);
+
+            g_Received.clear();
+            parser.ProcessData(batch);
+
+            ASSERT_EQ(g_Received.size(), batch.size());
+            for (size_t i = 0; i < batch.size(); i++) {
+                EXPECT_EQ(g_Received[i], std::vector<uint8_t>(batch[i].Buffer(), batch[i].Buffer() + batch[i].size()));
+            }
+        }
+    #endif
+
+    #if __has_include(<MidiCore/DeviceBase/DeviceBase.h>)
+        class BatchDevice : public DeviceBase {
+        public:
+            using DeviceBase::MidiOutput;
+        };
+
+        TEST(MessageBatchTest, DeviceOutputsEachMessage) {
+            MessageBatch batch;
+            batch.NoteOn(60, 100).NoteOff(60).Continue();
+
+            BatchDevice device;
+            device.BindMidiOut(Collect);
+
+            g_Received.clear();
+            device.MidiOutput(batch);
+
+            ASSERT_EQ(g_Received.size(), 3u);
+            EXPECT_EQ(g_Received[2], std::vector<uint8_t>{MIDI_REALTIME_CONTINUE});
+        }
+    #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MessageParser/BasicMessageParser.h>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        using Messages = std::vector<std::vector<uint8_t>>;
+
+        // Declares every callback
+        struct FullHandler {
+            Messages ChannelVoice, ControlChange, RealTime, SystemCommon, MTC, SysEx, Default;
+
+            void OnChannelVoice(const uint8_t* data, size_t size) { ChannelVoice.emplace_back(data, data + size); }
+            void OnControlChange(const uint8_t* data, size_t size) { ControlChange.emplace_back(data, data + size); }
+            void OnRealTime(const uint8_t* data, size_t size) { RealTime.emplace_back(data, data + size); }
+            void OnSystemCommon(const uint8_t* data, size_t size) { SystemCommon.emplace_back(data, data + size); }
+            void OnMTC(const uint8_t* data, size_t size) { MTC.emplace_back(data, data + size); }
+            void OnSysEx(const uint8_t* data, size_t size) { SysEx.emplace_back(data, data + size); }
+            void OnDefault(const uint8_t* data, size_t size) { Default.emplace_back(data, data + size); }
+        };
+
+        // Declares a few callbacks, the others fall back
+        struct PartialHandler {
+            Messages ChannelVoice, SystemCommon, Default;
+
+            void OnChannelVoice(const uint8_t* data, size_t size) { ChannelVoice.emplace_back(data, data + size); }
+            void OnSystemCommon(const uint8_t* data, size_t size) { SystemCommon.emplace_back(data, data + size); }
+            void OnDefault(const uint8_t* data, size_t size) { Default.emplace_back(data, data + size); }
+        };
+
+        // Only interested in Channel Voice, everything else is compiled away
+        struct ChannelVoiceOnly {
+            Messages ChannelVoice;
+
+            void OnChannelVoice(const uint8_t* data, size_t size) { ChannelVoice.emplace_back(data, data + size); }
+        };
+
+        // Overloaded and templated callbacks, which cannot be named through a member pointer
+        struct OverloadedHandler {
+            Messages ChannelVoice, RealTime;
+
+            void OnChannelVoice(const uint8_t* data, size_t size) { ChannelVoice.emplace_back(data, data + size); }
+            void OnChannelVoice(const Messages::value_type& message) { ChannelVoice.push_back(message); }
+
+            template <typename Size>
+            void OnRealTime(const uint8_t* data, Size size) { RealTime.emplace_back(data, data + size); }
+        };
+
+        template <typename Parser>
+        void Feed(Parser& parser, const std::vector<uint8_t>& stream) {
+            parser.ProcessData(stream.data(), stream.size());
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Routing
+
+        TEST(BasicMessageParser, RoutesToEveryCallback) {
+            FullHandler handler;
+            BasicMessageParser<FullHandler, 16> parser(handler);
+
+            Feed(parser, {0x90, 60, 100, 0xB0, 7, 0x7F, 0xF8, 0xF2, 1, 2, 0xF1, 0x23, 0xF0, 0x7D, 1, 0xF7, 0xF6});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}}));
+            EXPECT_EQ(handler.ControlChange, (Messages{{0xB0, 7, 0x7F}}));
+            EXPECT_EQ(handler.RealTime, (Messages{{0xF8}}));
+            EXPECT_EQ(handler.SystemCommon, (Messages{{0xF2, 1, 2}, {0xF6}}));
+            EXPECT_EQ(handler.MTC, (Messages{{0xF1, 0x23}}));
+            EXPECT_EQ(handler.SysEx, (Messages{{0xF0, 0x7D, 1, 0xF7}}));
+            EXPECT_TRUE(handler.Default.empty());
+        }
+
+        TEST(BasicMessageParser, MissingCallbacksFallBack) {
+            PartialHandler handler;
+            BasicMessageParser<PartialHandler, 16> parser(handler);
+
+            Feed(parser, {0xB0, 7, 0x7F, 0xF1, 0x23, 0xF8, 0xF0, 1, 0xF7});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0xB0, 7, 0x7F}}));
+            EXPECT_EQ(handler.SystemCommon, (Messages{{0xF1, 0x23}}));
+            EXPECT_EQ(handler.Default, (Messages{{0xF8}, {0xF0, 1, 0xF7}}));
+        }
+
+        TEST(BasicMessageParser, UndeclaredCategoriesAreSkipped) {
+            ChannelVoiceOnly handler;
+            BasicMessageParser<ChannelVoiceOnly> parser(handler);
+
+            Feed(parser, {0xF8, 0x90, 60, 0xF8, 100, 0xF2, 1, 2, 0xC0, 5});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}, {0xC0, 5}}));
+        }
+
+        TEST(BasicMessageParser, OverloadedAndTemplatedCallbacksAreFound) {
+            OverloadedHandler handler;
+            BasicMessageParser<OverloadedHandler> parser(handler);
+
+            Feed(parser, {0x90, 60, 100, 0xF8});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}}));
+            EXPECT_EQ(handler.RealTime, (Messages{{0xF8}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Parsing
+
+        TEST(BasicMessageParser, RunningStatusAcrossCalls) {
+            ChannelVoiceOnly handler;
+            BasicMessageParser<ChannelVoiceOnly> parser(handler);
+            EXPECT_FALSE(parser.RunningStatusEnabled());
+            parser.SetRunningStatus(true);
+
+            Feed(parser, {0x90, 60});
+            Feed(parser, {100, 62});
+            Feed(parser, {90, 64, 80});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}, {0x90, 62, 90}, {0x90, 64, 80}}));
+
+            handler.ChannelVoice.clear();
+            parser.SetRunningStatus(false);
+            EXPECT_FALSE(parser.RunningStatusEnabled());
+            Feed(parser, {0x90, 60, 100, 62, 100});
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}}));
+
+            handler.ChannelVoice.clear();
+            parser.SetRunningStatus(true);
+            Feed(parser, {0x80, 60});
+            parser.Reset();
+            Feed(parser, {0, 62, 0});
+            EXPECT_TRUE(handler.ChannelVoice.empty());
+        }
+
+        TEST(BasicMessageParser, SysExLongerThanBufferIsDropped) {
+            FullHandler handler;
+            BasicMessageParser<FullHandler, 4> parser(handler);
+
+            Feed(parser, {0xF0, 1, 2, 0xF7, 0xF0, 1, 2, 3, 4, 0xF7, 0x90, 60, 100});
+            EXPECT_EQ(handler.SysEx, (Messages{{0xF0, 1, 2, 0xF7}}));
+            EXPECT_EQ(handler.ChannelVoice, (Messages{{0x90, 60, 100}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
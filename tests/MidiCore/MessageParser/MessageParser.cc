@@ -0,0 +1,692 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MessageParser/MessageParser.h>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        using Messages = std::vector<std::vector<uint8_t>>;
+
+        Messages g_Messages;
+
+        void Collect(const uint8_t* data, size_t size) {
+            g_Messages.emplace_back(data, data + size);
+        }
+
+        // Parses a stream with every callback routed to the default callback
+        Messages Parse(MessageParser& parser, const std::vector<uint8_t>& stream) {
+            g_Messages.clear();
+            parser.BindDefaultCallback(Collect);
+            parser.ProcessData(stream.data(), stream.size());
+            return g_Messages;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Routing
+
+        Messages g_Specific;
+
+        void CollectSpecific(const uint8_t* data, size_t size) {
+            g_Specific.emplace_back(data, data + size);
+        }
+
+        TEST(MessageParser, ControlChangeFallsBackToChannelVoice) {
+            MessageParser parser;
+            g_Specific.clear();
+            parser.BindChannelVoiceCallback(CollectSpecific);
+
+            Messages out = Parse(parser, {0xB0, 1, 2, 0x90, 60, 100, 0xF6});
+            EXPECT_EQ(g_Specific, (Messages{{0xB0, 1, 2}, {0x90, 60, 100}}));
+            EXPECT_EQ(out, (Messages{{0xF6}}));
+        }
+
+        TEST(MessageParser, TimeCodeFallsBackToSystemCommon) {
+            MessageParser parser;
+            g_Specific.clear();
+            parser.BindSystemCommonCallback(CollectSpecific);
+
+            Messages out = Parse(parser, {0xF1, 0x23, 0xF3, 4, 0xF2, 1, 2, 0xC0, 5});
+            EXPECT_EQ(g_Specific, (Messages{{0xF1, 0x23}, {0xF3, 4}, {0xF2, 1, 2}}));
+            EXPECT_EQ(out, (Messages{{0xC0, 5}}));
+
+            g_Specific.clear();
+            g_Messages.clear();
+            parser.BindMTCCallback(Collect);
+            const uint8_t stream[] = {0xF1, 0x10, 0xF3, 4};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Messages, (Messages{{0xF1, 0x10}}));
+            EXPECT_EQ(g_Specific, (Messages{{0xF3, 4}}));
+        }
+
+        TEST(MessageParser, EveryStatusByteHasItsSize) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            for (unsigned int status = 0x80; status < 0xF0; status++) {
+                size_t size = MidiProtocol::StatusTable[static_cast<uint8_t>(status)].Size;
+                Messages out = Parse(parser, {static_cast<uint8_t>(status), 1, 2});
+                ASSERT_EQ(out.size(), (size == 2) ? 2u : 1u) << std::hex << status;
+                EXPECT_EQ(out[0].size(), size);
+            }
+        }
+
+        TEST(MessageParser, StatusByteEndsIncompleteMessage) {
+            MessageParser parser(16);
+            Messages out = Parse(parser, {0x90, 60, 0x80, 60, 0, 0xF0, 0x01, 0xB0, 7, 100});
+            EXPECT_EQ(out, (Messages{{0x80, 60, 0}, {0xB0, 7, 100}}));
+        }
+
+        TEST(MessageParser, UndefinedStatusBytesAreIgnored) {
+            MessageParser parser;
+            Messages out = Parse(parser, {0xF4, 1, 0xF5, 0xF7, 2, 0xF2, 1, 2});
+            EXPECT_EQ(out, (Messages{{0xF2, 1, 2}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Bulk Input
+
+        TEST(MessageParser, CompleteMessagesPointIntoInput) {
+            static const uint8_t* s_Received;
+            s_Received = nullptr;
+
+            MessageParser parser;
+            parser.BindDefaultCallback([](const uint8_t* data, size_t) { s_Received = data; });
+
+            const uint8_t stream[] = {0x90, 60, 100};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(s_Received, stream);
+        }
+
+        TEST(MessageParser, SameResultForAnySplit) {
+            std::vector<uint8_t> stream = {0x90, 60, 100, 62, 0xF8, 100, 0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                           16, 17, 18, 19, 20, 0xFE, 21, 0xF7, 0xB1, 7, 0xF8, 100, 0xC2, 5, 6, 0xF2, 1, 2, 0xF6};
+            MessageParser whole(64);
+            whole.SetRunningStatus(true);
+            Messages expected = Parse(whole, stream);
+            ASSERT_EQ(expected.size(), 11u);
+
+            for (size_t chunk = 1; chunk < stream.size(); chunk++) {
+                MessageParser parser(64);
+                parser.SetRunningStatus(true);
+                g_Messages.clear();
+                parser.BindDefaultCallback(Collect);
+                for (size_t offset = 0; offset < stream.size(); offset += chunk) {
+                    parser.ProcessData(stream.data() + offset, std::min(chunk, stream.size() - offset));
+                }
+                EXPECT_EQ(g_Messages, expected) << "chunk " << chunk;
+            }
+        }
+
+        TEST(MessageParser, LongSysExOverflowDropsMessage) {
+            MessageParser parser(40);
+            std::vector<uint8_t> stream = {0xF0};
+            for (int i = 0; i < 100; i++) stream.push_back(static_cast<uint8_t>(i));
+            stream.insert(stream.end(), {0xF7, 0x90, 60, 100});
+
+            Messages out = Parse(parser, stream);
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}}));
+
+            stream.erase(stream.begin() + 39, stream.begin() + 101);
+            out = Parse(parser, stream);
+            ASSERT_EQ(out.size(), 2u);
+            EXPECT_EQ(out[0].size(), 40u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Streamed SysEx
+
+        struct StreamLog {
+            std::vector<uint8_t> Bytes;
+            std::vector<MessageParser::SysExChunk> Chunks;
+            size_t LargestChunk = 0;
+        };
+
+        StreamLog g_Stream;
+
+        void CollectStream(const uint8_t* data, size_t size, MessageParser::SysExChunk chunk) {
+            g_Stream.Bytes.insert(g_Stream.Bytes.end(), data, data + size);
+            g_Stream.Chunks.push_back(chunk);
+            g_Stream.LargestChunk = std::max(g_Stream.LargestChunk, size);
+        }
+
+        TEST(MessageParser, StreamedSysExSingleChunk) {
+            MessageParser parser(16);
+            g_Stream = StreamLog();
+            g_Messages.clear();
+            parser.BindSysExCallback(Collect);
+            parser.BindSysExStreamCallback(CollectStream);
+
+            const uint8_t stream[] = {0xF0, 0x7D, 1, 2, 0xF7};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Stream.Bytes, std::vector<uint8_t>(stream, stream + sizeof(stream)));
+            EXPECT_EQ(g_Stream.Chunks, (std::vector<MessageParser::SysExChunk>{MessageParser::SysExChunk::Complete}));
+            EXPECT_TRUE(g_Messages.empty());
+        }
+
+        TEST(MessageParser, StreamedSysExLargerThanBuffer) {
+            MessageParser parser(8);
+            g_Stream = StreamLog();
+            parser.BindSysExStreamCallback(CollectStream);
+
+            std::vector<uint8_t> stream = {0xF0};
+            for (int i = 0; i < 5000; i++) stream.push_back(static_cast<uint8_t>(i & 0x7F));
+            stream.push_back(0xF7);
+
+            // Feed it in small pieces, with clock bytes in between
+            const uint8_t clock = 0xF8;
+            for (size_t offset = 0; offset < stream.size(); offset += 5) {
+                parser.ProcessData(stream.data() + offset, std::min<size_t>(5, stream.size() - offset));
+                parser.ProcessData(&clock, 1);
+            }
+
+            EXPECT_EQ(g_Stream.Bytes, stream);
+            ASSERT_GE(g_Stream.Chunks.size(), 3u);
+            EXPECT_EQ(g_Stream.Chunks.front(), MessageParser::SysExChunk::Start);
+            EXPECT_EQ(g_Stream.Chunks.back(), MessageParser::SysExChunk::End);
+            for (size_t i = 1; i + 1 < g_Stream.Chunks.size(); i++) {
+                EXPECT_EQ(g_Stream.Chunks[i], MessageParser::SysExChunk::Continue);
+            }
+            EXPECT_LE(g_Stream.LargestChunk, 8u);
+        }
+
+        TEST(MessageParser, StreamedSysExLongRunsComeFromInput) {
+            MessageParser parser(4);
+            g_Stream = StreamLog();
+            parser.BindSysExStreamCallback(CollectStream);
+
+            std::vector<uint8_t> stream = {0xF0};
+            for (int i = 0; i < 1000; i++) stream.push_back(0x55);
+            stream.push_back(0xF7);
+            parser.ProcessData(stream.data(), stream.size());
+
+            EXPECT_EQ(g_Stream.Bytes, stream);
+            EXPECT_EQ(g_Stream.Chunks, (std::vector<MessageParser::SysExChunk>{
+                MessageParser::SysExChunk::Start, MessageParser::SysExChunk::Continue, MessageParser::SysExChunk::End}));
+        }
+
+        TEST(MessageParser, StreamedSysExAbort) {
+            MessageParser parser(16);
+            g_Stream = StreamLog();
+            parser.BindSysExStreamCallback(CollectStream);
+
+            Messages out = Parse(parser, {0xF0, 1, 2});
+            out = Parse(parser, {3, 0x90, 60, 100});
+            EXPECT_EQ(g_Stream.Chunks, (std::vector<MessageParser::SysExChunk>{MessageParser::SysExChunk::Start, MessageParser::SysExChunk::Abort}));
+            EXPECT_EQ(g_Stream.Bytes, (std::vector<uint8_t>{0xF0, 1, 2}));
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}}));
+
+            // Aborting before anything was delivered reports nothing
+            g_Stream = StreamLog();
+            Parse(parser, {0xF0, 1, 0xF2, 1, 2});
+            EXPECT_TRUE(g_Stream.Chunks.empty());
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Universal SysEx
+
+        Messages g_Universal;
+
+        void CollectUniversal(const uint8_t* data, size_t size) {
+            g_Universal.emplace_back(data, data + size);
+        }
+
+        TEST(MessageParser, UniversalSysExReachesDedicatedCallbacks) {
+            MessageParser parser(32);
+            g_Specific.clear();
+            g_Universal.clear();
+            parser.BindMSCCallback(CollectSpecific);
+            parser.BindMMCCallback(CollectSpecific);
+            parser.BindMTCCallback(CollectSpecific);
+            parser.BindUniversalSysExCallback(CollectUniversal);
+
+            std::vector<uint8_t> msc = {0xF0, 0x7F, 0x01, 0x02, 0x01, 0x01, '1', 0xF7};     // MSC Go, cue 1
+            std::vector<uint8_t> mmc = {0xF0, 0x7F, 0x7F, 0x06, 0x02, 0xF7};                 // MMC Play
+            std::vector<uint8_t> full = {0xF0, 0x7F, 0x7F, 0x01, 0x01, 0x21, 2, 3, 4, 0xF7}; // MTC Full Frame
+            std::vector<uint8_t> inquiry = {0xF0, 0x7E, 0x7F, 0x06, 0x01, 0xF7};             // Device Inquiry
+            std::vector<uint8_t> vendor = {0xF0, 0x41, 0x10, 0x42, 0x12, 0xF7};
+
+            std::vector<uint8_t> stream;
+            for (const std::vector<uint8_t>* m : {&msc, &mmc, &full, &inquiry, &vendor}) {
+                stream.insert(stream.end(), m->begin(), m->end());
+            }
+            stream.insert(stream.end(), {0xF1, 0x23});
+
+            Messages out = Parse(parser, stream);
+            EXPECT_EQ(g_Specific, (Messages{msc, mmc, full, {0xF1, 0x23}}));
+            EXPECT_EQ(g_Universal, (Messages{inquiry}));
+            EXPECT_EQ(out, (Messages{vendor}));
+        }
+
+        TEST(MessageParser, UniversalSysExFallsBack) {
+            MessageParser parser(32);
+            g_Universal.clear();
+            parser.BindUniversalSysExCallback(CollectUniversal);
+
+            // MMC without an MMC callback reaches the Universal callback, then the SysEx chain
+            Messages out = Parse(parser, {0xF0, 0x7F, 0x7F, 0x06, 0x01, 0xF7});
+            EXPECT_EQ(g_Universal, (Messages{{0xF0, 0x7F, 0x7F, 0x06, 0x01, 0xF7}}));
+            EXPECT_TRUE(out.empty());
+
+            parser.UnbindUniversalSysExCallback();
+            out = Parse(parser, {0xF0, 0x7F, 0x7F, 0x06, 0x01, 0xF7});
+            EXPECT_EQ(out, (Messages{{0xF0, 0x7F, 0x7F, 0x06, 0x01, 0xF7}}));
+        }
+
+        TEST(MessageParser, UniversalSysExDeviceID) {
+            MessageParser parser(32);
+            g_Specific.clear();
+            parser.BindMMCCallback(CollectSpecific);
+            parser.SetDeviceID(0x05);
+            EXPECT_EQ(parser.DeviceID(), 0x05);
+
+            Messages out = Parse(parser, {0xF0, 0x7F, 0x05, 0x06, 0x02, 0xF7,     // This device
+                                          0xF0, 0x7F, 0x7F, 0x06, 0x02, 0xF7,     // All call
+                                          0xF0, 0x7F, 0x06, 0x06, 0x02, 0xF7});   // Another device
+            EXPECT_EQ(g_Specific, (Messages{{0xF0, 0x7F, 0x05, 0x06, 0x02, 0xF7}, {0xF0, 0x7F, 0x7F, 0x06, 0x02, 0xF7}}));
+            EXPECT_EQ(out, (Messages{{0xF0, 0x7F, 0x06, 0x06, 0x02, 0xF7}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Timestamps
+
+        struct TimeRecorder {
+            MessageParser Parser{16};
+            Messages Received;
+            std::vector<SystemCore::Clock::TimePoint> Times;
+
+            void OnMessage(const uint8_t* data, size_t size) {
+                Received.emplace_back(data, data + size);
+                Times.push_back(Parser.MessageTime());
+            }
+
+            TimeRecorder() { Parser.BindDefaultCallback<TimeRecorder, &TimeRecorder::OnMessage>(this); }
+        };
+
+        TEST(MessageParser, TimestampsInterpolatedAcrossChunk) {
+            TimeRecorder recorder;
+            recorder.Parser.SetRunningStatus(true);
+
+            // Byte i arrives at 1000 + 320 * i
+            const uint8_t stream[] = {0x90, 60, 100, 62, 0xF8, 100, 0xC0, 5};
+            recorder.Parser.ProcessData(stream, sizeof(stream), 1000, 320);
+            EXPECT_EQ(recorder.Received, (Messages{{0x90, 60, 100}, {0xF8}, {0x90, 62, 100}, {0xC0, 5}}));
+            EXPECT_EQ(recorder.Times, (std::vector<SystemCore::Clock::TimePoint>{1000, 2280, 1960, 2920}));
+        }
+
+        TEST(MessageParser, TimestampsPerByte) {
+            TimeRecorder recorder;
+
+            // A message split across chunks keeps the time of its status byte
+            const uint8_t first[] = {0xB0, 7};
+            const SystemCore::Clock::TimePoint first_times[] = {500, 501};
+            const uint8_t second[] = {100, 0xF0, 1, 2, 0xF7};
+            const SystemCore::Clock::TimePoint second_times[] = {900, 901, 950, 951, 990};
+            recorder.Parser.ProcessData(first, sizeof(first), first_times);
+            recorder.Parser.ProcessData(second, sizeof(second), second_times);
+
+            EXPECT_EQ(recorder.Received, (Messages{{0xB0, 7, 100}, {0xF0, 1, 2, 0xF7}}));
+            EXPECT_EQ(recorder.Times, (std::vector<SystemCore::Clock::TimePoint>{500, 901}));
+
+            // Untimed data is stamped 0
+            recorder.Times.clear();
+            const uint8_t note[] = {0x90, 60, 100};
+            recorder.Parser.ProcessData(note, sizeof(note));
+            EXPECT_EQ(recorder.Times, (std::vector<SystemCore::Clock::TimePoint>{0}));
+        }
+
+        TEST(MessageParser, MissingTimesParseUntimed) {
+            TimeRecorder recorder;
+
+            // A transfer without times still completes the message in progress
+            const uint8_t first[] = {0x90, 60};
+            const SystemCore::Clock::TimePoint first_times[] = {700, 701};
+            const uint8_t second[] = {100, 0xC0, 5};
+            recorder.Parser.ProcessData(first, sizeof(first), first_times);
+            recorder.Parser.ProcessData(second, sizeof(second), static_cast<const SystemCore::Clock::TimePoint*>(nullptr));
+
+            EXPECT_EQ(recorder.Received, (Messages{{0x90, 60, 100}, {0xC0, 5}}));
+            EXPECT_EQ(recorder.Times, (std::vector<SystemCore::Clock::TimePoint>{700, 0}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Batched Dispatch
+
+        std::vector<Messages> g_Batches;
+        std::vector<std::vector<MidiProtocol::MessageCategory>> g_Categories;
+
+        void CollectBatch(const MessageParser::Batch& batch) {
+            Messages messages;
+            std::vector<MidiProtocol::MessageCategory> categories;
+            for (size_t i = 0; i < batch.size(); i++) {
+                MessageView view = batch[i];
+                messages.emplace_back(view.Buffer(), view.Buffer() + view.size());
+                categories.push_back(batch.Entry(i).Category);
+            }
+            g_Batches.push_back(messages);
+            g_Categories.push_back(categories);
+        }
+
+        TEST(MessageParser, BatchCollectsOneChunk) {
+            MessageParser parser(16);
+            parser.SetRunningStatus(true);
+            MessageParser::StaticBatch<16, 64> batch;
+            g_Batches.clear();
+            g_Categories.clear();
+            g_Messages.clear();
+            parser.BindDefaultCallback(Collect);
+            parser.BindBatchCallback(CollectBatch, batch);
+
+            const uint8_t stream[] = {0x90, 60, 100, 62, 0xF8, 100, 0xB0, 7, 90, 0xF0, 1, 2, 0xF7, 0xF1, 0x10};
+            parser.ProcessData(stream, sizeof(stream));
+
+            ASSERT_EQ(g_Batches.size(), 1u);
+            EXPECT_EQ(g_Batches[0], (Messages{{0x90, 60, 100}, {0xF8}, {0x90, 62, 100}, {0xB0, 7, 90}, {0xF0, 1, 2, 0xF7}, {0xF1, 0x10}}));
+            EXPECT_EQ(g_Categories[0], (std::vector<MidiProtocol::MessageCategory>{
+                MidiProtocol::MessageCategory::ChannelVoice, MidiProtocol::MessageCategory::RealTime,
+                MidiProtocol::MessageCategory::ChannelVoice, MidiProtocol::MessageCategory::ChannelVoice,
+                MidiProtocol::MessageCategory::SystemExclusive, MidiProtocol::MessageCategory::SystemCommon}));
+            EXPECT_TRUE(g_Messages.empty());
+            EXPECT_TRUE(batch.empty());
+
+            // No batch for a chunk that completes no message
+            const uint8_t partial[] = {0x90, 60};
+            parser.ProcessData(partial, sizeof(partial));
+            EXPECT_EQ(g_Batches.size(), 1u);
+        }
+
+        std::vector<SystemCore::Clock::TimePoint> g_BatchTimes;
+
+        void CollectBatchTimes(const MessageParser::Batch& batch) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                g_BatchTimes.push_back(batch.Entry(i).Time);
+            }
+        }
+
+        std::vector<std::vector<uint8_t>> g_Arrivals;
+
+        void ArrivalBatch(const MessageParser::Batch& batch) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                MessageView view = batch[i];
+                g_Arrivals.emplace_back(view.Buffer(), view.Buffer() + view.size());
+            }
+        }
+
+        void ArrivalStream(const uint8_t* data, size_t size, MessageParser::SysExChunk chunk) {
+            g_Arrivals.emplace_back(data, data + size);
+            if (chunk == MessageParser::SysExChunk::Abort) {
+                g_Arrivals.back().push_back(0xFF); // Marks the abort notification
+            }
+        }
+
+        TEST(MessageParser, BatchAndSysExStreamKeepArrivalOrder) {
+            MessageParser parser(16);
+            MessageParser::StaticBatch<16, 64> batch;
+            g_Arrivals.clear();
+            parser.BindBatchCallback(ArrivalBatch, batch);
+            parser.BindSysExStreamCallback(ArrivalStream);
+
+            const uint8_t first[] = {0x90, 60, 64, 0xF0, 1, 2, 0xF7, 0xC0, 5, 0xF0, 3};
+            const uint8_t second[] = {0xF8, 4, 0x90, 62, 0};
+            parser.ProcessData(first, sizeof(first));
+            parser.ProcessData(second, sizeof(second));
+
+            EXPECT_EQ(g_Arrivals, (Messages{
+                {0x90, 60, 64}, {0xF0, 1, 2, 0xF7}, {0xC0, 5}, {0xF0, 3}, {0xF8}, {0xFF}, {0x90, 62, 0}}));
+        }
+
+        TEST(MessageParser, BatchEntriesCarryTimestamps) {
+            MessageParser parser(16);
+            MessageParser::StaticBatch<16, 64> batch;
+            g_BatchTimes.clear();
+            parser.BindBatchCallback(CollectBatchTimes, batch);
+
+            const uint8_t stream[] = {0x90, 60, 100, 0xF8, 0xC0, 5};
+            parser.ProcessData(stream, sizeof(stream), 100, 10);
+            EXPECT_EQ(g_BatchTimes, (std::vector<SystemCore::Clock::TimePoint>{100, 130, 140}));
+        }
+
+        TEST(MessageParser, FullBatchIsFlushedEarly) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            MessageParser::StaticBatch<2, 64> batch;
+            g_Batches.clear();
+            g_Categories.clear();
+            parser.BindBatchCallback(CollectBatch, batch);
+
+            const uint8_t stream[] = {0x90, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Batches, (std::vector<Messages>{{{0x90, 1, 1}, {0x90, 2, 2}}, {{0x90, 3, 3}, {0x90, 4, 4}}, {{0x90, 5, 5}}}));
+
+            MessageParser::StaticBatch<16, 7> small;
+            g_Batches.clear();
+            parser.BindBatchCallback(CollectBatch, small);
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Batches, (std::vector<Messages>{{{0x90, 1, 1}, {0x90, 2, 2}}, {{0x90, 3, 3}, {0x90, 4, 4}}, {{0x90, 5, 5}}}));
+        }
+
+        TEST(MessageParser, OversizedMessageBypassesBatch) {
+            MessageParser parser(16);
+            MessageParser::StaticBatch<8, 4> batch;
+            g_Batches.clear();
+            g_Categories.clear();
+            g_Messages.clear();
+            parser.BindSysExCallback(Collect);
+            parser.BindBatchCallback(CollectBatch, batch);
+
+            const uint8_t stream[] = {0xC0, 1, 0xF0, 1, 2, 3, 0xF7, 0xC0, 2};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Batches, (std::vector<Messages>{{{0xC0, 1}}, {{0xC0, 2}}}));
+            EXPECT_EQ(g_Messages, (Messages{{0xF0, 1, 2, 3, 0xF7}}));
+        }
+
+        TEST(MessageParser, UnbindBatchRestoresCallbacks) {
+            MessageParser parser;
+            MessageParser::StaticBatch<8, 32> batch;
+            g_Batches.clear();
+            parser.BindBatchCallback(CollectBatch, batch);
+            parser.UnbindBatchCallback();
+
+            Messages out = Parse(parser, {0x90, 60, 100});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}}));
+            EXPECT_TRUE(g_Batches.empty());
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Running Status
+
+        TEST(MessageParser, RunningStatusIsOptIn) {
+            MessageParser parser;
+            EXPECT_FALSE(parser.RunningStatusEnabled());
+            EXPECT_EQ(Parse(parser, {0x90, 60, 100, 62, 100, 64, 0}), (Messages{{0x90, 60, 100}}));
+
+            parser.SetRunningStatus(true);
+            EXPECT_TRUE(parser.RunningStatusEnabled());
+            Messages out = Parse(parser, {0x90, 60, 100, 62, 100, 64, 0});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0x90, 62, 100}, {0x90, 64, 0}}));
+        }
+
+        TEST(MessageParser, RunningStatusTwoByteMessages) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            Messages out = Parse(parser, {0xC3, 1, 2, 3, 0xD0, 0x40, 0x41});
+            EXPECT_EQ(out, (Messages{{0xC3, 1}, {0xC3, 2}, {0xC3, 3}, {0xD0, 0x40}, {0xD0, 0x41}}));
+        }
+
+        TEST(MessageParser, RunningStatusAcrossCalls) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            Parse(parser, {0xB0, 7, 100});
+
+            g_Messages.clear();
+            const uint8_t first[] = {7};
+            const uint8_t second[] = {90};
+            parser.ProcessData(first, sizeof(first));
+            EXPECT_TRUE(g_Messages.empty());
+            parser.ProcessData(second, sizeof(second));
+            EXPECT_EQ(g_Messages, (Messages{{0xB0, 7, 90}}));
+        }
+
+        TEST(MessageParser, RealTimeKeepsRunningStatus) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            Messages out = Parse(parser, {0x90, 60, 100, 0xF8, 62, 100, 0xFE, 64, 100});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0xF8}, {0x90, 62, 100}, {0xFE}, {0x90, 64, 100}}));
+        }
+
+        TEST(MessageParser, SystemCommonClearsRunningStatus) {
+            MessageParser parser;
+            Messages out = Parse(parser, {0x90, 60, 100, 0xF3, 5, 62, 100, 0xF6, 64, 100});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0xF3, 5}, {0xF6}}));
+        }
+
+        TEST(MessageParser, SysExClearsRunningStatus) {
+            MessageParser parser(16);
+            Messages out = Parse(parser, {0x90, 60, 100, 0xF0, 0x7D, 0x01, 0xF7, 62, 100});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0xF0, 0x7D, 0x01, 0xF7}}));
+        }
+
+        TEST(MessageParser, ChannelVoiceCallbacksReceiveCompleteMessages) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            g_Messages.clear();
+            parser.BindControlChangeCallback(Collect);
+            const uint8_t stream[] = {0xB2, 64, 127, 64, 0};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Messages, (Messages{{0xB2, 64, 127}, {0xB2, 64, 0}}));
+        }
+
+        TEST(MessageParser, LegacyModeDropsDataWithoutStatus) {
+            MessageParser parser;
+            parser.SetRunningStatus(false);
+            EXPECT_FALSE(parser.RunningStatusEnabled());
+
+            Messages out = Parse(parser, {0x90, 60, 100, 62, 100, 0x80, 60, 0});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0x80, 60, 0}}));
+        }
+
+        TEST(MessageParser, ResetClearsRunningStatus) {
+            MessageParser parser;
+            Parse(parser, {0x90, 60, 100, 62});
+            parser.Reset();
+
+            Messages out = Parse(parser, {64, 100, 0x80, 60, 0});
+            EXPECT_EQ(out, (Messages{{0x80, 60, 0}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Real-Time
+
+        TEST(MessageParser, RealTimeInsideChannelVoice) {
+            MessageParser parser;
+            Messages out = Parse(parser, {0x90, 0xF8, 60, 0xF8, 100, 0xB0, 7, 0xFE, 90});
+            EXPECT_EQ(out, (Messages{{0xF8}, {0xF8}, {0x90, 60, 100}, {0xFE}, {0xB0, 7, 90}}));
+        }
+
+        TEST(MessageParser, RealTimeInsideSysEx) {
+            MessageParser parser(16);
+            Messages out = Parse(parser, {0xF0, 0x7D, 0xF8, 0x01, 0x02, 0xFA, 0xF7});
+            EXPECT_EQ(out, (Messages{{0xF8}, {0xFA}, {0xF0, 0x7D, 0x01, 0x02, 0xF7}}));
+        }
+
+        TEST(MessageParser, RealTimeInsideSystemCommon) {
+            MessageParser parser;
+            Messages out = Parse(parser, {0xF2, 0x10, 0xFC, 0x20});
+            EXPECT_EQ(out, (Messages{{0xFC}, {0xF2, 0x10, 0x20}}));
+        }
+
+        TEST(MessageParser, RealTimeUsesRealTimeCallback) {
+            MessageParser parser;
+            g_Messages.clear();
+            parser.BindRealTimeCallback(Collect);
+
+            const uint8_t stream[] = {0x90, 60, 0xF8, 100, 0xFB};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_Messages, (Messages{{0xF8}, {0xFB}}));
+        }
+
+        TEST(MessageParser, UndefinedRealTimeIsIgnored) {
+            MessageParser parser;
+            parser.SetRunningStatus(true);
+            Messages out = Parse(parser, {0x90, 60, 0xF9, 100, 0xFD, 62, 100});
+            EXPECT_EQ(out, (Messages{{0x90, 60, 100}, {0x90, 62, 100}}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    #if defined(MIDILAR_MESSAGE_PARSER_STATISTICS)
+    // Statistics
+
+        TEST(MessageParser, StatisticsCountMessages) {
+            MessageParser parser(16);
+            parser.SetRunningStatus(true);
+            g_Specific.clear();
+            parser.BindChannelVoiceCallback(CollectSpecific);
+
+            std::vector<uint8_t> stream = {0x90, 60, 100, 0xF8, 62, 100, 0xB0, 7, 0x7F, 0xF1, 0x23, 0xF0, 1, 2, 3, 0xF7, 0xF6};
+            Parse(parser, stream);
+
+            MessageParser::Statistics stats = parser.GetStatistics();
+            EXPECT_EQ(stats.BytesProcessed, stream.size());
+            EXPECT_EQ(stats.ChannelVoiceMessages, 3u);
+            EXPECT_EQ(stats.SystemCommonMessages, 2u);
+            EXPECT_EQ(stats.SysExMessages, 1u);
+            EXPECT_EQ(stats.RealTimeMessages, 1u);
+            EXPECT_EQ(stats.MaxSysExSize, 5u);
+            EXPECT_EQ(stats.DefaultFallthroughs, 4u); // Everything but the Channel Voice messages
+            EXPECT_EQ(stats.StrayDataBytes, 0u);
+            EXPECT_EQ(stats.BufferOverflows, 0u);
+
+            parser.ResetStatistics();
+            stats = parser.GetStatistics();
+            EXPECT_EQ(stats.BytesProcessed, 0u);
+            EXPECT_EQ(stats.ChannelVoiceMessages, 0u);
+            EXPECT_EQ(stats.MaxSysExSize, 0u);
+            EXPECT_EQ(stats.DefaultFallthroughs, 0u);
+        }
+
+        TEST(MessageParser, StatisticsCountDrops) {
+            MessageParser parser(4);
+
+            // Data without a status, then an interrupted SysEx, then one too long for the buffer
+            Parse(parser, {1, 2, 3, 0xF0, 1, 0x90, 60, 100, 0xF0, 1, 2, 3, 4, 5, 0xF7});
+            MessageParser::Statistics stats = parser.GetStatistics();
+            EXPECT_EQ(stats.StrayDataBytes, 3u);
+            EXPECT_EQ(stats.SysExAborts, 1u);
+            EXPECT_EQ(stats.BufferOverflows, 1u);
+            EXPECT_EQ(stats.SysExMessages, 0u);
+            EXPECT_EQ(stats.ChannelVoiceMessages, 1u);
+
+            // A SysEx filling the buffer exactly has no room left for 0xF7
+            Parse(parser, {0xF0, 1, 2, 3, 0xF7});
+            EXPECT_EQ(parser.GetStatistics().BufferOverflows, 2u);
+
+            Parse(parser, {0xF0, 1});
+            parser.Reset();
+            EXPECT_EQ(parser.GetStatistics().SysExAborts, 2u);
+        }
+
+        TEST(MessageParser, StatisticsCountStreamedSysEx) {
+            MessageParser parser(8);
+            g_Stream = StreamLog();
+            parser.BindSysExStreamCallback(CollectStream);
+
+            std::vector<uint8_t> stream = {0xF0};
+            for (int i = 0; i < 100; i++) stream.push_back(0x55);
+            stream.push_back(0xF7);
+            parser.ProcessData(stream.data(), stream.size());
+
+            MessageParser::Statistics stats = parser.GetStatistics();
+            EXPECT_EQ(stats.SysExMessages, 1u);
+            EXPECT_EQ(stats.MaxSysExSize, stream.size());
+            EXPECT_EQ(stats.BufferOverflows, 0u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    #endif
+}
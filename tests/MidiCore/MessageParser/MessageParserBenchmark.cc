@@ -0,0 +1,190 @@
+// Measures MessageParser throughput on a synthetic capture.
+// Not registered with CTest: run MIDILAR_Midi_MessageParser_Benchmark from the build's bin directory.
+
+#include <MidiCore/MessageParser/MessageParser.h>
+#include <MidiCore/MessageParser/ParserBank.h>
+#include <MidiCore/MessageParser/BasicMessageParser.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+    size_t g_Messages = 0;
+    size_t g_Bytes = 0;
+
+    void Count(const uint8_t*, size_t size) {
+        g_Messages++;
+        g_Bytes += size;
+    }
+
+    void CountBatch(const MIDILAR::MidiCore::MessageParser::Batch& batch) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            g_Messages++;
+            g_Bytes += batch.Entry(i).Size;
+        }
+    }
+
+    void CountPort(size_t, const uint8_t*, size_t size) {
+        g_Messages++;
+        g_Bytes += size;
+    }
+
+    struct Counter {
+        void OnDefault(const uint8_t*, size_t size) {
+            g_Messages++;
+            g_Bytes += size;
+        }
+    };
+
+    // Builds a stream resembling a live capture: notes and controllers with and without running status,
+    // a clock byte every few messages (sometimes inside a message), and occasional SysEx.
+    std::vector<uint8_t> BuildCapture(size_t Size) {
+        std::vector<uint8_t> stream;
+        stream.reserve(Size + 64);
+        uint32_t seed = 0x12345678;
+        auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+
+        while (stream.size() < Size) {
+            uint32_t r = next();
+            uint8_t channel = r & 0x0F;
+            switch ((r >> 4) % 8) {
+                case 0: case 1: case 2:
+                    stream.insert(stream.end(), {static_cast<uint8_t>(0x90 | channel), static_cast<uint8_t>(r >> 8 & 0x7F), 100});
+                    break;
+                case 3:
+                    stream.insert(stream.end(), {static_cast<uint8_t>(0x80 | channel), static_cast<uint8_t>(r >> 8 & 0x7F), 0});
+                    break;
+                case 4:
+                    stream.insert(stream.end(), {static_cast<uint8_t>(0xB0 | channel), 7, static_cast<uint8_t>(r >> 8 & 0x7F)});
+                    break;
+                case 5:
+                    stream.insert(stream.end(), {static_cast<uint8_t>(0xE0 | channel), 0x00, 0x40, 0xF8});
+                    break;
+                case 6:
+                    stream.insert(stream.end(), {static_cast<uint8_t>(0xD0 | channel), static_cast<uint8_t>(r >> 8 & 0x7F)});
+                    break;
+                default:
+                    if ((r >> 12) % 16 == 0) {
+                        stream.push_back(0xF0);
+                        for (int i = 0; i < 32; i++) stream.push_back(static_cast<uint8_t>(i));
+                        stream.push_back(0xF7);
+                    } else {
+                        stream.insert(stream.end(), {0xF8, 0xF1, static_cast<uint8_t>(r >> 8 & 0x7F)});
+                    }
+                    break;
+            }
+        }
+        return stream;
+    }
+
+    // Builds a stream of large SysEx dumps with clock bytes between them, as in a sample or patch transfer
+    std::vector<uint8_t> BuildDump(size_t Size, size_t DumpSize) {
+        std::vector<uint8_t> stream;
+        stream.reserve(Size + DumpSize + 8);
+
+        while (stream.size() < Size) {
+            stream.push_back(0xF0);
+            for (size_t i = 0; i < DumpSize; i++) stream.push_back(static_cast<uint8_t>(i & 0x7F));
+            stream.insert(stream.end(), {0xF7, 0xF8, 0x90, 60, 100});
+        }
+        return stream;
+    }
+
+    // Returns the best throughput of a few runs, in bytes per second
+    double Measure(MIDILAR::MidiCore::MessageParser& Parser, const std::vector<uint8_t>& Capture, int Passes, size_t& Messages) {
+        Parser.ProcessData(Capture.data(), Capture.size()); // Warm up
+
+        double best = 0.0;
+        for (int run = 0; run < 5; run++) {
+            g_Messages = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < Passes; i++) {
+                Parser.ProcessData(Capture.data(), Capture.size());
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            double rate = static_cast<double>(Capture.size()) * Passes / elapsed.count();
+            best = (rate > best) ? rate : best;
+        }
+
+        Messages = g_Messages / static_cast<size_t>(Passes);
+        return best;
+    }
+
+    // Feeds the capture to many ports in small chunks, as a host servicing many low-rate inputs does.
+    // `Process(port, data, size)` parses one chunk. Returns the best throughput in bytes per second.
+    template <typename ProcessType>
+    double MeasurePorts(ProcessType Process, size_t Ports, const std::vector<uint8_t>& Capture, int Passes) {
+        const size_t chunk = 16;
+        double best = 0.0;
+        for (int run = 0; run < 5; run++) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < Passes; i++) {
+                size_t port = 0;
+                for (size_t offset = 0; offset + chunk <= Capture.size(); offset += chunk) {
+                    Process(port, Capture.data() + offset, chunk);
+                    port = (port + 1 == Ports) ? 0 : port + 1;
+                }
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            double rate = static_cast<double>(Capture.size()) * Passes / elapsed.count();
+            best = (rate > best) ? rate : best;
+        }
+        return best;
+    }
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+int main(int argc, char** argv) {
+    using namespace MIDILAR::MidiCore;
+
+    const size_t size = 1 << 20;
+    const int passes = (argc > 1) ? atoi(argv[1]) : 200;
+    size_t messages = 0;
+
+    std::vector<uint8_t> capture = BuildCapture(size);
+    MessageParser parser(64);
+    parser.SetRunningStatus(true);
+    parser.BindDefaultCallback(Count);
+    double rate = Measure(parser, capture, passes, messages);
+    printf("MessageParser, live capture: %.1f MB/s (%zu messages per pass)\n", rate / 1e6, messages);
+
+    static MessageParser::StaticBatch<256, 4096> batch;
+    MessageParser batch_parser(64);
+    batch_parser.SetRunningStatus(true);
+    batch_parser.BindBatchCallback(CountBatch, batch);
+    rate = Measure(batch_parser, capture, passes, messages);
+    printf("MessageParser, live capture, batched: %.1f MB/s (%zu messages per pass)\n", rate / 1e6, messages);
+
+    Counter counter;
+    BasicMessageParser<Counter, 64> static_parser(counter);
+    static_parser.SetRunningStatus(true);
+    rate = MeasurePorts([&static_parser](size_t, const uint8_t* data, size_t length) { static_parser.ProcessData(data, length); }, 1, capture, passes);
+    printf("BasicMessageParser, live capture: %.1f MB/s\n", rate / 1e6);
+
+    static MessageParser ports[64];
+    for (MessageParser& port : ports) {
+        port.SetRunningStatus(true);
+        port.BindDefaultCallback(Count);
+    }
+    rate = MeasurePorts([](size_t port, const uint8_t* data, size_t length) { ports[port].ProcessData(data, length); }, 64, capture, passes);
+    printf("MessageParser x 64 ports:    %.1f MB/s (%zu bytes of parsers)\n", rate / 1e6, sizeof(ports));
+
+    static ParserBank<64> bank;
+    bank.SetRunningStatus(true);
+    bank.BindDefaultCallback(CountPort);
+    rate = MeasurePorts([](size_t port, const uint8_t* data, size_t length) { bank.ProcessData(port, data, length); }, 64, capture, passes);
+    printf("ParserBank<64>:              %.1f MB/s (%zu bytes of parsers)\n", rate / 1e6, sizeof(bank));
+
+    std::vector<uint8_t> dump = BuildDump(size, 4096);
+    MessageParser dump_parser(4096 + 2);
+    dump_parser.BindDefaultCallback(Count);
+    rate = Measure(dump_parser, dump, passes, messages);
+    printf("MessageParser, SysEx dump:   %.1f MB/s (%zu messages per pass)\n", rate / 1e6, messages);
+    return 0;
+}
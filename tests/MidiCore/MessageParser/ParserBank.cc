@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MessageParser/ParserBank.h>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        struct Received {
+            size_t Port;
+            std::vector<uint8_t> Bytes;
+
+            bool operator==(const Received& Other) const { return Port == Other.Port && Bytes == Other.Bytes; }
+        };
+
+        struct Chunk {
+            size_t Port;
+            std::vector<uint8_t> Bytes;
+            MessageParser::SysExChunk Position;
+
+            bool operator==(const Chunk& Other) const { return Port == Other.Port && Bytes == Other.Bytes && Position == Other.Position; }
+        };
+
+        std::vector<Received> g_Received;
+        std::vector<Received> g_ChannelVoice;
+        std::vector<Chunk> g_Chunks;
+
+        void Collect(size_t Port, const uint8_t* data, size_t size) {
+            g_Received.push_back({Port, std::vector<uint8_t>(data, data + size)});
+        }
+
+        void CollectChannelVoice(size_t Port, const uint8_t* data, size_t size) {
+            g_ChannelVoice.push_back({Port, std::vector<uint8_t>(data, data + size)});
+        }
+
+        void CollectChunk(size_t Port, const uint8_t* data, size_t size, MessageParser::SysExChunk Position) {
+            g_Chunks.push_back({Port, std::vector<uint8_t>(data, data + size), Position});
+        }
+
+        template <size_t Ports>
+        void Feed(ParserBank<Ports>& bank, size_t Port, const std::vector<uint8_t>& stream) {
+            bank.ProcessData(Port, stream.data(), stream.size());
+        }
+
+        void Clear() {
+            g_Received.clear();
+            g_ChannelVoice.clear();
+            g_Chunks.clear();
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Messages
+
+        TEST(ParserBank, PortsKeepSeparateState) {
+            ParserBank<4> bank;
+            bank.SetRunningStatus(true);
+            Clear();
+            bank.BindDefaultCallback(Collect);
+
+            // Messages split across calls and interleaved between ports
+            Feed(bank, 0, {0x90, 60});
+            Feed(bank, 3, {0xB2, 7});
+            Feed(bank, 0, {100, 62});
+            Feed(bank, 3, {127});
+            Feed(bank, 0, {90});
+
+            EXPECT_EQ(g_Received, (std::vector<Received>{
+                {0, {0x90, 60, 100}}, {3, {0xB2, 7, 127}}, {0, {0x90, 62, 90}}}));
+        }
+
+        TEST(ParserBank, CallbacksFallBack) {
+            ParserBank<2> bank;
+            Clear();
+            bank.BindDefaultCallback(Collect);
+            bank.BindChannelVoiceCallback(CollectChannelVoice);
+
+            Feed(bank, 1, {0xB0, 1, 2, 0xC0, 5, 0xF1, 0x23, 0xF6, 0xF8});
+            EXPECT_EQ(g_ChannelVoice, (std::vector<Received>{{1, {0xB0, 1, 2}}, {1, {0xC0, 5}}}));
+            EXPECT_EQ(g_Received, (std::vector<Received>{{1, {0xF1, 0x23}}, {1, {0xF6}}, {1, {0xF8}}}));
+        }
+
+        TEST(ParserBank, RunningStatusAndRealTime) {
+            ParserBank<2> bank;
+            EXPECT_FALSE(bank.RunningStatusEnabled());
+            bank.SetRunningStatus(true);
+            Clear();
+            bank.BindDefaultCallback(Collect);
+
+            Feed(bank, 0, {0x90, 60, 0xF8, 100, 62, 100});
+            Feed(bank, 1, {60, 100}); // No status in effect on this port
+            EXPECT_EQ(g_Received, (std::vector<Received>{{0, {0xF8}}, {0, {0x90, 60, 100}}, {0, {0x90, 62, 100}}}));
+
+            Clear();
+            bank.SetRunningStatus(false);
+            Feed(bank, 0, {64, 100});
+            EXPECT_TRUE(g_Received.empty());
+        }
+
+        TEST(ParserBank, ResetDiscardsPartialMessage) {
+            ParserBank<2> bank;
+            Clear();
+            bank.BindDefaultCallback(Collect);
+
+            Feed(bank, 0, {0x90, 60});
+            Feed(bank, 1, {0x80, 60});
+            bank.Reset(0);
+            Feed(bank, 0, {100});
+            Feed(bank, 1, {0});
+            EXPECT_EQ(g_Received, (std::vector<Received>{{1, {0x80, 60, 0}}}));
+
+            // Out of range ports are ignored
+            Feed(bank, 2, {0x90, 60, 100});
+            EXPECT_EQ(g_Received.size(), 1u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SysEx
+
+        TEST(ParserBank, SysExStreamsFromInput) {
+            ParserBank<2> bank;
+            Clear();
+            bank.BindDefaultCallback(Collect);
+            bank.BindSysExCallback(CollectChunk);
+
+            std::vector<uint8_t> sysex = {0xF0, 0x7D, 1, 2, 3, 0xF7};
+            bank.ProcessData(0, sysex.data(), sysex.size());
+            ASSERT_EQ(g_Chunks.size(), 1u);
+            EXPECT_EQ(g_Chunks[0], (Chunk{0, sysex, MessageParser::SysExChunk::Complete}));
+
+            // Split across calls, interleaved with another port and with a clock byte inside
+            Clear();
+            Feed(bank, 1, {0xF0, 1, 2});
+            Feed(bank, 0, {0xF0, 9});
+            Feed(bank, 1, {3, 0xF8, 4, 0xF7});
+            Feed(bank, 0, {0xF7});
+            EXPECT_EQ(g_Chunks, (std::vector<Chunk>{
+                {1, {0xF0, 1, 2}, MessageParser::SysExChunk::Start},
+                {0, {0xF0, 9}, MessageParser::SysExChunk::Start},
+                {1, {3}, MessageParser::SysExChunk::Continue},
+                {1, {4, 0xF7}, MessageParser::SysExChunk::End},
+                {0, {0xF7}, MessageParser::SysExChunk::End}}));
+            EXPECT_EQ(g_Received, (std::vector<Received>{{1, {0xF8}}}));
+        }
+
+        TEST(ParserBank, SysExAbort) {
+            ParserBank<2> bank;
+            Clear();
+            bank.BindDefaultCallback(Collect);
+            bank.BindSysExCallback(CollectChunk);
+
+            Feed(bank, 0, {0xF0, 1, 2});
+            Feed(bank, 0, {3, 0x90, 60, 100});
+            EXPECT_EQ(g_Chunks, (std::vector<Chunk>{
+                {0, {0xF0, 1, 2}, MessageParser::SysExChunk::Start},
+                {0, {}, MessageParser::SysExChunk::Abort}}));
+            EXPECT_EQ(g_Received, (std::vector<Received>{{0, {0x90, 60, 100}}}));
+
+            // Interrupted before anything was delivered: nothing is reported
+            Clear();
+            Feed(bank, 1, {0xF0, 1, 0xF2, 1, 2});
+            EXPECT_TRUE(g_Chunks.empty());
+
+            Feed(bank, 1, {0xF0, 1});
+            bank.Reset();
+            EXPECT_EQ(g_Chunks.back(), (Chunk{1, {}, MessageParser::SysExChunk::Abort}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MidiFile/MidiFileReader.h>
+#include <MidiCore/MidiFile/MidiFileWriter.h>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<uint8_t> g_File;
+
+        void Collect(const uint8_t* data, size_t size) {
+            g_File.insert(g_File.end(), data, data + size);
+        }
+
+        std::vector<uint8_t> Render(MidiFileWriter& writer) {
+            g_File.clear();
+            writer.BindOutput(Collect);
+            EXPECT_TRUE(writer.Write());
+            return g_File;
+        }
+
+        std::vector<MidiFileReader::Event> Events(const MidiFileReader::Track& track) {
+            std::vector<MidiFileReader::Event> events;
+            for (const MidiFileReader::Event& e : track) {
+                events.push_back(e);
+            }
+            return events;
+        }
+
+        std::vector<uint8_t> Bytes(const MidiFileReader::Event& e) {
+            return std::vector<uint8_t>(e.Data(), e.Data() + e.size());
+        }
+
+        // Builds a file with a single track chunk holding the given body
+        std::vector<uint8_t> SingleTrackFile(const std::vector<uint8_t>& body) {
+            std::vector<uint8_t> file = {'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 0, 0, 1, 0x01, 0xE0,
+                                         'M', 'T', 'r', 'k', 0, 0, 0, static_cast<uint8_t>(body.size())};
+            file.insert(file.end(), body.begin(), body.end());
+            return file;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Header
+
+        TEST(MidiFileReader, ReadsHeaderAndTracks) {
+            MidiFileWriter writer(MidiFile::Format::MultiTrack, 960);
+            writer.AddTrack();
+            writer.AddTrack();
+            writer.AddTrack();
+            std::vector<uint8_t> file = Render(writer);
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            EXPECT_TRUE(reader.IsOpen());
+            EXPECT_EQ(reader.FileFormat(), MidiFile::Format::MultiTrack);
+            EXPECT_EQ(reader.Division(), 960);
+            EXPECT_EQ(reader.TrackCount(), 3u);
+            EXPECT_TRUE(reader.GetTrack(3).empty());
+
+            reader.Close();
+            EXPECT_FALSE(reader.IsOpen());
+            EXPECT_EQ(reader.TrackCount(), 0u);
+        }
+
+        TEST(MidiFileReader, RejectsInvalidHeader) {
+            MidiFileReader reader;
+            const uint8_t riff[] = {'R', 'I', 'F', 'F', 0, 0, 0, 6, 0, 0, 0, 1, 0x01, 0xE0};
+            EXPECT_FALSE(reader.Open(riff, sizeof(riff)));
+            EXPECT_FALSE(reader.Open(riff, 8));
+            EXPECT_FALSE(reader.Open(static_cast<const uint8_t*>(nullptr), 0));
+            EXPECT_FALSE(reader.IsOpen());
+        }
+
+        TEST(MidiFileReader, SkipsUnknownChunks) {
+            std::vector<uint8_t> file = {'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, 0, 1, 0x00, 0x60,
+                                         'X', 'F', 'I', 'H', 0, 0, 0, 2, 0xAA, 0xBB,
+                                         'M', 'T', 'r', 'k', 0, 0, 0, 4, 0x00, 0xFF, 0x2F, 0x00};
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            ASSERT_EQ(reader.TrackCount(), 1u);
+            EXPECT_EQ(reader.GetTrack(0).size(), 4u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Events
+
+        TEST(MidiFileReader, RoundTripThroughWriter) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+            writer.Tempo(track, 0, 500000);
+            writer.Event(track, 0, ShortMessage::NoteOn(60, 100));
+            writer.Event(track, 240, ShortMessage::NoteOn(64, 90));   // Running status
+            writer.Event(track, 480, ShortMessage::NoteOff(60));
+            const uint8_t sysex[] = {0xF0, 0x7E, 0x7F, 0x09, 0x01, 0xF7};
+            writer.Event(track, 480, sysex, sizeof(sysex));
+            writer.Event(track, 960, ShortMessage::TimingTick());
+            std::vector<uint8_t> file = Render(writer);
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            std::vector<MidiFileReader::Event> events = Events(reader.GetTrack(0));
+            ASSERT_EQ(events.size(), 7u);
+
+            EXPECT_EQ(events[0].Type(), MidiFileReader::EventType::Meta);
+            EXPECT_EQ(events[0].MetaType(), MidiFile::MetaType::Tempo);
+            EXPECT_EQ(Bytes(events[0]), (std::vector<uint8_t>{0x07, 0xA1, 0x20}));
+            EXPECT_TRUE(events[0].View().empty());
+
+            EXPECT_EQ(events[1].Type(), MidiFileReader::EventType::Midi);
+            EXPECT_EQ(events[1].Tick(), 0u);
+            EXPECT_EQ(events[1].View().Kind(), MidiProtocol::MessageKind::NoteOn);
+            EXPECT_EQ(events[1].View().Note(), 60);
+
+            // The status byte omitted in the file is restored
+            EXPECT_EQ(events[2].Tick(), 240u);
+            EXPECT_EQ(Bytes(events[2]), (std::vector<uint8_t>{0x90, 64, 90}));
+
+            EXPECT_EQ(events[3].Tick(), 480u);
+            EXPECT_EQ(events[3].View().Kind(), MidiProtocol::MessageKind::NoteOff);
+
+            EXPECT_EQ(events[4].Type(), MidiFileReader::EventType::SysEx);
+            EXPECT_EQ(events[4].Tick(), 480u);
+            EXPECT_EQ(Bytes(events[4]), (std::vector<uint8_t>(sysex + 1, sysex + sizeof(sysex))));
+
+            EXPECT_EQ(events[5].Type(), MidiFileReader::EventType::Escape);
+            EXPECT_EQ(events[5].Tick(), 960u);
+            EXPECT_EQ(events[5].View().Kind(), MidiProtocol::MessageKind::TimingTick);
+
+            EXPECT_EQ(events[6].Type(), MidiFileReader::EventType::Meta);
+            EXPECT_EQ(events[6].MetaType(), MidiFile::MetaType::EndOfTrack);
+            EXPECT_EQ(events[6].Tick(), 960u);
+        }
+
+        TEST(MidiFileReader, EventsPointIntoTheFile) {
+            std::vector<uint8_t> file = SingleTrackFile({0x00, 0xC0, 0x05, 0x10, 0x07, 0x00, 0xFF, 0x2F, 0x00});
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            MidiFileReader::const_iterator it = reader.GetTrack(0).begin();
+
+            // Explicit status: the event is a view of the file itself
+            EXPECT_EQ(it->Data(), file.data() + 23);
+            EXPECT_EQ(it->size(), 2u);
+
+            // Running status with a two byte message
+            ++it;
+            EXPECT_EQ(it->Tick(), 0x10u);
+            EXPECT_EQ(Bytes(*it), (std::vector<uint8_t>{0xC0, 0x07}));
+
+            MidiFileReader::const_iterator copy = it;
+            ++it;
+            EXPECT_EQ(Bytes(*copy), (std::vector<uint8_t>{0xC0, 0x07}));
+            EXPECT_EQ(it->MetaType(), MidiFile::MetaType::EndOfTrack);
+            EXPECT_EQ(++it, reader.GetTrack(0).end());
+        }
+
+        TEST(MidiFileReader, RunningStatusSurvivesMetaEvents) {
+            std::vector<uint8_t> file = SingleTrackFile({0x00, 0x90, 0x3C, 0x40, 0x00, 0xFF, 0x01, 0x01, 'a', 0x00, 0x3E, 0x40});
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            std::vector<MidiFileReader::Event> events = Events(reader.GetTrack(0));
+            ASSERT_EQ(events.size(), 3u);
+            EXPECT_EQ(Bytes(events[2]), (std::vector<uint8_t>{0x90, 0x3E, 0x40}));
+        }
+
+        TEST(MidiFileReader, StopsAtMalformedEvents) {
+            MidiFileReader reader;
+
+            // Data byte without a status in effect
+            std::vector<uint8_t> orphan = SingleTrackFile({0x00, 0x3C, 0x40});
+            ASSERT_TRUE(reader.Open(orphan.data(), orphan.size()));
+            EXPECT_TRUE(Events(reader.GetTrack(0)).empty());
+
+            // Message cut by the end of the chunk
+            std::vector<uint8_t> truncated = SingleTrackFile({0x00, 0x90, 0x3C, 0x40, 0x10, 0x90, 0x3C});
+            ASSERT_TRUE(reader.Open(truncated.data(), truncated.size()));
+            EXPECT_EQ(Events(reader.GetTrack(0)).size(), 1u);
+
+            // Meta length beyond the end of the chunk
+            std::vector<uint8_t> meta = SingleTrackFile({0x00, 0xFF, 0x01, 0x7F, 'a'});
+            ASSERT_TRUE(reader.Open(meta.data(), meta.size()));
+            EXPECT_TRUE(Events(reader.GetTrack(0)).empty());
+
+            // Bytes after End of Track are ignored
+            std::vector<uint8_t> trailing = SingleTrackFile({0x00, 0xFF, 0x2F, 0x00, 0x00, 0x90, 0x3C, 0x40});
+            ASSERT_TRUE(reader.Open(trailing.data(), trailing.size()));
+            EXPECT_EQ(Events(reader.GetTrack(0)).size(), 1u);
+        }
+
+        TEST(MidiFileReader, TruncatedChunkIsClamped) {
+            std::vector<uint8_t> file = SingleTrackFile({0x00, 0x90, 0x3C, 0x40, 0x10, 0x80, 0x3C, 0x00});
+            file[21] = 0x40; // Declared length larger than the file
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+            ASSERT_EQ(reader.TrackCount(), 1u);
+            EXPECT_EQ(reader.GetTrack(0).size(), 8u);
+            EXPECT_EQ(Events(reader.GetTrack(0)).size(), 2u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Files
+
+        TEST(MidiFileReader, OpenMapsFile) {
+            MidiFileWriter writer;
+            size_t tempo = writer.AddTrack();
+            size_t notes = writer.AddTrack();
+            writer.Tempo(tempo, 0, 600000);
+            for (uint32_t i = 0; i < 1000; i++) {
+                writer.Event(notes, i * 10, ShortMessage::NoteOn(static_cast<uint8_t>(i % 128), 100));
+            }
+
+            const char* path = "MidiFileReader_test.mid";
+            ASSERT_TRUE(writer.WriteFile(path));
+
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(path));
+            ASSERT_EQ(reader.TrackCount(), 2u);
+
+            size_t count = 0;
+            for (const MidiFileReader::Event& e : reader.GetTrack(1)) {
+                if (e.Type() == MidiFileReader::EventType::Midi) {
+                    EXPECT_EQ(e.Tick(), count * 10);
+                    EXPECT_EQ(e.View().Note(), count % 128);
+                    count++;
+                }
+            }
+            EXPECT_EQ(count, 1000u);
+
+            reader.Close();
+            remove(path);
+            EXPECT_FALSE(reader.Open("MidiFileReader_missing.mid"));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
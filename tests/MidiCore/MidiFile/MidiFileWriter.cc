@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <MidiCore/MidiFile/MidiFileWriter.h>
+#include <MidiCore/MidiFile/MidiFileReader.h>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<uint8_t> g_Output;
+
+        void Collect(const uint8_t* data, size_t size) {
+            g_Output.insert(g_Output.end(), data, data + size);
+        }
+
+        std::vector<uint8_t> Render(MidiFileWriter& writer) {
+            g_Output.clear();
+            writer.BindOutput(Collect);
+            EXPECT_TRUE(writer.Write());
+            return g_Output;
+        }
+
+        // Returns the body of the track chunk at the given index
+        std::vector<uint8_t> TrackBody(const std::vector<uint8_t>& file, size_t index) {
+            size_t offset = MidiFile::HeaderSize;
+            for (size_t i = 0; offset + 8 <= file.size(); i++) {
+                size_t length = (size_t(file[offset + 4]) << 24) | (size_t(file[offset + 5]) << 16) | (size_t(file[offset + 6]) << 8) | file[offset + 7];
+                if (i == index) {
+                    return std::vector<uint8_t>(file.begin() + offset + 8, file.begin() + offset + 8 + length);
+                }
+                offset += 8 + length;
+            }
+            return {};
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Variable-Length Quantities
+
+        TEST(MidiFile, VariableLengthRoundTrip) {
+            const uint32_t values[] = {0, 0x40, 0x7F, 0x80, 0x2000, 0x3FFF, 0x4000, 0x100000, 0x1FFFFF, 0x200000, 0x8000000, 0x0FFFFFFF};
+            const size_t sizes[] = {1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4};
+
+            for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+                uint8_t buffer[MidiFile::MaxVariableLengthSize];
+                ASSERT_EQ(MidiFile::WriteVariableLength(buffer, values[i]), sizes[i]);
+
+                uint32_t decoded = 0;
+                ASSERT_EQ(MidiFile::ReadVariableLength(buffer, sizes[i], decoded), sizes[i]);
+                EXPECT_EQ(decoded, values[i]);
+            }
+
+            uint8_t encoded[2];
+            MidiFile::WriteVariableLength(encoded, 0x80);
+            EXPECT_EQ(encoded[0], 0x81);
+            EXPECT_EQ(encoded[1], 0x00);
+
+            uint32_t value = 0;
+            EXPECT_EQ(MidiFile::ReadVariableLength(encoded, 1, value), 0u); // Truncated
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // File Layout
+
+        TEST(MidiFileWriter, HeaderAndEndOfTrack) {
+            MidiFileWriter writer(MidiFile::Format::MultiTrack, 960);
+            ASSERT_EQ(writer.AddTrack(), 0u);
+            ASSERT_EQ(writer.AddTrack(), 1u);
+
+            std::vector<uint8_t> file = Render(writer);
+            const uint8_t header[] = {'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, 0, 2, 0x03, 0xC0};
+            ASSERT_EQ(file.size(), writer.FileSize());
+            ASSERT_GE(file.size(), sizeof(header));
+            EXPECT_TRUE(std::equal(header, header + sizeof(header), file.begin()));
+
+            const std::vector<uint8_t> end = {0x00, 0xFF, 0x2F, 0x00};
+            EXPECT_EQ(TrackBody(file, 0), end);
+            EXPECT_EQ(TrackBody(file, 1), end);
+        }
+
+        TEST(MidiFileWriter, SingleTrackFormatAllowsOneTrack) {
+            MidiFileWriter writer(MidiFile::Format::SingleTrack);
+            EXPECT_EQ(writer.AddTrack(), 0u);
+            EXPECT_EQ(writer.AddTrack(), MidiFileWriter::InvalidTrack);
+            EXPECT_FALSE(writer.Event(1, 0, ShortMessage::NoteOn(60, 100)));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Events
+
+        TEST(MidiFileWriter, RunningStatusAndDeltaTimes) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+
+            EXPECT_TRUE(writer.Event(track, 0, ShortMessage::NoteOn(60, 100)));
+            EXPECT_TRUE(writer.Event(track, 0, ShortMessage::NoteOn(64, 100)));
+            EXPECT_TRUE(writer.Event(track, 200, ShortMessage::NoteOn(60, 0)));
+            EXPECT_TRUE(writer.Event(track, 200, ShortMessage::ControlChange(7, 90)));
+            EXPECT_TRUE(writer.Event(track, 100, ShortMessage::ControlChange(7, 80))); // Earlier than last: delta 0
+
+            const std::vector<uint8_t> expected = {
+                0x00, 0x90, 60, 100,
+                0x00, 64, 100,
+                0x81, 0x48, 60, 0,
+                0x00, 0xB0, 7, 90,
+                0x00, 7, 80,
+                0x00, 0xFF, 0x2F, 0x00
+            };
+            EXPECT_EQ(TrackBody(Render(writer), track), expected);
+        }
+
+        TEST(MidiFileWriter, SystemEventsCancelRunningStatus) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+            const uint8_t sysex[] = {0xF0, 0x7E, 0x7F, 0x06, 0x01, 0xF7};
+
+            EXPECT_TRUE(writer.Event(track, 0, ShortMessage::NoteOn(60, 100)));
+            EXPECT_TRUE(writer.Event(track, 0, sysex, sizeof(sysex)));
+            EXPECT_TRUE(writer.Event(track, 0, ShortMessage::NoteOn(62, 100)));
+            EXPECT_TRUE(writer.Event(track, 10, ShortMessage::TimingTick()));
+            EXPECT_TRUE(writer.Event(track, 10, ShortMessage::NoteOn(64, 100)));
+            EXPECT_TRUE(writer.Tempo(track, 10, 500000));
+            EXPECT_TRUE(writer.Event(track, 10, ShortMessage::NoteOn(65, 100)));
+
+            const std::vector<uint8_t> expected = {
+                0x00, 0x90, 60, 100,
+                0x00, 0xF0, 0x05, 0x7E, 0x7F, 0x06, 0x01, 0xF7,
+                0x00, 0x90, 62, 100,
+                0x0A, 0xF7, 0x01, 0xF8,
+                0x00, 0x90, 64, 100,
+                0x00, 0xFF, 0x51, 0x03, 0x07, 0xA1, 0x20,
+                0x00, 0x90, 65, 100,
+                0x00, 0xFF, 0x2F, 0x00
+            };
+            EXPECT_EQ(TrackBody(Render(writer), track), expected);
+        }
+
+        TEST(MidiFileWriter, MetaEvents) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+
+            EXPECT_TRUE(writer.TrackName(track, "Tempo"));
+            EXPECT_TRUE(writer.TimeSignature(track, 0, 6, 3));
+            EXPECT_TRUE(writer.EndOfTrack(track, 1920));
+            EXPECT_FALSE(writer.Event(track, 1920, ShortMessage::NoteOn(60, 100))); // Track is ended
+
+            const std::vector<uint8_t> expected = {
+                0x00, 0xFF, 0x03, 0x05, 'T', 'e', 'm', 'p', 'o',
+                0x00, 0xFF, 0x58, 0x04, 6, 3, 24, 8,
+                0x8F, 0x00, 0xFF, 0x2F, 0x00
+            };
+            EXPECT_EQ(TrackBody(Render(writer), track), expected);
+        }
+
+        TEST(MidiFileWriter, RejectsInvalidEvents) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+            const uint8_t data_only[] = {0x40, 0x40};
+            const uint8_t truncated[] = {0x90, 60};
+
+            EXPECT_FALSE(writer.Event(track, 0, data_only, sizeof(data_only)));
+            EXPECT_FALSE(writer.Event(track, 0, truncated, sizeof(truncated)));
+            EXPECT_FALSE(writer.Event(track, 0, nullptr, 0));
+            EXPECT_FALSE(writer.Event(track + 1, 0, ShortMessage::NoteOn(60, 100)));
+        }
+
+        TEST(MidiFileWriter, LongSysExFromMessage) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+
+            std::vector<uint8_t> payload(300, 0x11);
+            Message sysex;
+            sysex.SystemExclusive(payload.data(), payload.size());
+            EXPECT_TRUE(writer.Event(track, 0, sysex));
+
+            std::vector<uint8_t> body = TrackBody(Render(writer), track);
+            ASSERT_GE(body.size(), 4u);
+            EXPECT_EQ(body[1], 0xF0);
+            EXPECT_EQ(body[2], 0x82); // 301 bytes after 0xF0
+            EXPECT_EQ(body[3], 0x2D);
+            EXPECT_EQ(body.size(), 1 + 1 + 2 + 301 + 4);
+        }
+
+        TEST(MidiFileWriter, RunningStatusSequenceFromMessage) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+
+            // CC 99, 98, 6 and 38 on channel 3, with the last three under running status
+            Message nrpn;
+            nrpn.CC_NRPN(static_cast<uint16_t>(0x0123), static_cast<uint16_t>(0x1FFF), 2);
+            ASSERT_EQ(nrpn.size(), 9u);
+            EXPECT_TRUE(writer.Event(track, 0, nrpn));
+            EXPECT_TRUE(writer.Event(track, 10, ShortMessage::ControlChange(7, 100, 2)));
+
+            // Ends partway through the second message
+            const uint8_t truncated[] = {0xB2, 7, 100, 10};
+            EXPECT_FALSE(writer.Event(track, 20, truncated, sizeof(truncated)));
+
+            std::vector<uint8_t> file = Render(writer);
+            MidiFileReader reader;
+            ASSERT_TRUE(reader.Open(file.data(), file.size()));
+
+            std::vector<std::vector<uint8_t>> messages;
+            std::vector<uint32_t> ticks;
+            for (const MidiFileReader::Event& e : reader.GetTrack(0)) {
+                if (e.Type() == MidiFileReader::EventType::Midi) {
+                    messages.emplace_back(e.Data(), e.Data() + e.size());
+                    ticks.push_back(e.Tick());
+                }
+            }
+
+            EXPECT_EQ(messages, (std::vector<std::vector<uint8_t>>{
+                {0xB2, 99, 0x02}, {0xB2, 98, 0x23}, {0xB2, 6, 0x3F}, {0xB2, 38, 0x7F}, {0xB2, 7, 100}}));
+            EXPECT_EQ(ticks, (std::vector<uint32_t>{0, 0, 0, 0, 10}));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Files
+
+        TEST(MidiFileWriter, WriteFileMatchesCallbackOutput) {
+            MidiFileWriter writer;
+            size_t track = writer.AddTrack();
+            for (uint32_t i = 0; i < 1000; i++) {
+                writer.Event(track, i * 10, ShortMessage::NoteOn(static_cast<uint8_t>(i % 128), 100));
+            }
+
+            const char* path = "MidiFileWriter_test.mid";
+            ASSERT_TRUE(writer.WriteFile(path));
+            std::vector<uint8_t> expected = Render(writer);
+
+            FILE* file = fopen(path, "rb");
+            ASSERT_NE(file, nullptr);
+            std::vector<uint8_t> contents(expected.size() + 1);
+            size_t read = fread(contents.data(), 1, contents.size(), file);
+            fclose(file);
+            remove(path);
+
+            contents.resize(read);
+            EXPECT_EQ(contents, expected);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
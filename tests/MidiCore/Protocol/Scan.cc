@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Protocol/Scan.h>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore::Protocol {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        // Pseudo-random data bytes, the same on every run
+        std::vector<uint8_t> DataPattern(size_t size) {
+            std::vector<uint8_t> data(size);
+            uint32_t state = 0x12345678;
+            for (size_t i = 0; i < size; i++) {
+                state = state * 1103515245 + 12345;
+                data[i] = static_cast<uint8_t>((state >> 16) & 0x7F);
+            }
+            return data;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Data Runs
+
+        TEST(Scan, DataRunLengthFindsFirstStatusByte) {
+            for (size_t size = 0; size < 100; size++) {
+                std::vector<uint8_t> data = DataPattern(size);
+                ASSERT_EQ(Scan::DataRunLength(data.data(), size), size);
+
+                for (size_t position = 0; position < size; position++) {
+                    std::vector<uint8_t> marked = data;
+                    marked[position] = 0xF7;
+                    if (position + 3 < size) {
+                        marked[position + 3] = 0x90;
+                    }
+                    ASSERT_EQ(Scan::DataRunLength(marked.data(), size), position) << "size " << size;
+                    ASSERT_EQ(Scan::Scalar::DataRunLength(marked.data(), size), position);
+                }
+            }
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
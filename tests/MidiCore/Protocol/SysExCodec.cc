@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Protocol/SysExCodec.h>
+#include <vector>
+#include <cstdint>
+
+#if __has_include(<MidiCore/Message/Message.h>)
+    #include <MidiCore/Message/Message.h>
+    #include <MidiCore/Message/MessageView.h>
+    #include <MidiCore/Message/SysExWriter.h>
+#endif
+
+namespace MIDILAR::MidiCore::Protocol {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        std::vector<uint8_t> Pattern(size_t size) {
+            std::vector<uint8_t> data(size);
+            uint32_t state = 0x12345678;
+            for (size_t i = 0; i < size; i++) {
+                state = state * 1103515245 + 12345;
+                data[i] = static_cast<uint8_t>(state >> 16);
+            }
+            return data;
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Sizes
+
+        TEST(SysExCodec, Sizes) {
+            EXPECT_EQ(SysExCodec::Pack7BitSize(0), 0u);
+            EXPECT_EQ(SysExCodec::Pack7BitSize(1), 2u);
+            EXPECT_EQ(SysExCodec::Pack7BitSize(7), 8u);
+            EXPECT_EQ(SysExCodec::Pack7BitSize(8), 10u);
+
+            EXPECT_EQ(SysExCodec::Unpack7BitSize(0), 0u);
+            EXPECT_EQ(SysExCodec::Unpack7BitSize(1), 0u);
+            EXPECT_EQ(SysExCodec::Unpack7BitSize(8), 7u);
+            EXPECT_EQ(SysExCodec::Unpack7BitSize(10), 8u);
+
+            EXPECT_EQ(SysExCodec::NibblizeSize(5), 10u);
+            EXPECT_EQ(SysExCodec::DenibblizeSize(11), 5u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // 7-in-8 Packing
+
+        TEST(SysExCodec, Pack7BitLayout) {
+            const uint8_t data[] = {0x80, 0x01, 0xFF, 0x7F, 0x00, 0x81, 0x02, 0xC0};
+            const uint8_t expected[] = {0x25, 0x00, 0x01, 0x7F, 0x7F, 0x00, 0x01, 0x02, 0x01, 0x40};
+
+            uint8_t out[SysExCodec::Pack7BitSize(sizeof(data))];
+            ASSERT_EQ(SysExCodec::Pack7Bit(data, sizeof(data), out), sizeof(expected));
+            for (size_t i = 0; i < sizeof(expected); i++) {
+                EXPECT_EQ(out[i], expected[i]) << "index " << i;
+            }
+        }
+
+        TEST(SysExCodec, Pack7BitMatchesScalarAndRoundTrips) {
+            for (size_t size = 0; size < 300; size++) {
+                std::vector<uint8_t> data = Pattern(size);
+                std::vector<uint8_t> packed(SysExCodec::Pack7BitSize(size));
+                std::vector<uint8_t> reference(packed.size());
+
+                ASSERT_EQ(SysExCodec::Pack7Bit(data.data(), size, packed.data()), packed.size());
+                ASSERT_EQ(SysExCodec::Scalar::Pack7Bit(data.data(), size, reference.data()), reference.size());
+                ASSERT_EQ(packed, reference) << "size " << size;
+
+                for (uint8_t byte : packed) {
+                    ASSERT_LT(byte, 0x80);
+                }
+
+                std::vector<uint8_t> unpacked(SysExCodec::Unpack7BitSize(packed.size()));
+                ASSERT_EQ(unpacked.size(), size);
+                ASSERT_EQ(SysExCodec::Unpack7Bit(packed.data(), packed.size(), unpacked.data()), size);
+                ASSERT_EQ(unpacked, data) << "size " << size;
+            }
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Nibblization
+
+        TEST(SysExCodec, NibblizeOrder) {
+            const uint8_t data[] = {0xA5, 0x3C};
+            uint8_t out[4];
+
+            ASSERT_EQ(SysExCodec::Nibblize(data, 2, out), 4u);
+            EXPECT_EQ(out[0], 0x0A);
+            EXPECT_EQ(out[1], 0x05);
+            EXPECT_EQ(out[2], 0x03);
+            EXPECT_EQ(out[3], 0x0C);
+
+            ASSERT_EQ(SysExCodec::Nibblize(data, 2, out, true), 4u);
+            EXPECT_EQ(out[0], 0x05);
+            EXPECT_EQ(out[1], 0x0A);
+        }
+
+        TEST(SysExCodec, NibblizeMatchesScalarAndRoundTrips) {
+            for (bool low_first : {false, true}) {
+                for (size_t size = 0; size < 200; size++) {
+                    std::vector<uint8_t> data = Pattern(size);
+                    std::vector<uint8_t> nibbles(SysExCodec::NibblizeSize(size));
+                    std::vector<uint8_t> reference(nibbles.size());
+
+                    ASSERT_EQ(SysExCodec::Nibblize(data.data(), size, nibbles.data(), low_first), nibbles.size());
+                    SysExCodec::Scalar::Nibblize(data.data(), size, reference.data(), low_first);
+                    ASSERT_EQ(nibbles, reference) << "size " << size;
+
+                    std::vector<uint8_t> joined(size);
+                    ASSERT_EQ(SysExCodec::Denibblize(nibbles.data(), nibbles.size(), joined.data(), low_first), size);
+                    ASSERT_EQ(joined, data) << "size " << size;
+                }
+            }
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Message Integration
+
+    #if __has_include(<MidiCore/Message/Message.h>)
+
+        TEST(SysExCodec, MessageBuilderAndViewRoundTrip) {
+            const uint8_t header[] = {0x42, 0x30};
+            std::vector<uint8_t> dump = Pattern(100);
+
+            Message msg;
+            msg.BeginSysEx().Append(header, sizeof(header)).AppendPacked7Bit(dump.data(), dump.size()).EndSysEx();
+            ASSERT_EQ(msg.size(), 1 + sizeof(header) + SysExCodec::Pack7BitSize(dump.size()) + 1);
+
+            MessageView view(msg);
+            std::vector<uint8_t> unpacked(dump.size());
+            ASSERT_EQ(view.SysExUnpack7Bit(sizeof(header), unpacked.data()), dump.size());
+            EXPECT_EQ(unpacked, dump);
+
+            msg.BeginSysEx().AppendNibblized(dump.data(), dump.size(), true).EndSysEx();
+            std::vector<uint8_t> joined(dump.size());
+            ASSERT_EQ(MessageView(msg).SysExDenibblize(0, joined.data(), true), dump.size());
+            EXPECT_EQ(joined, dump);
+        }
+
+        TEST(SysExCodec, WriterPackedMatchesMessage) {
+            std::vector<uint8_t> dump = Pattern(250);
+
+            static std::vector<uint8_t> streamed;
+            streamed.clear();
+
+            uint8_t chunk[16];
+            SysExWriter writer(chunk, sizeof(chunk));
+            writer.BindOutput([](const uint8_t* data, size_t size) { streamed.insert(streamed.end(), data, data + size); });
+            writer.Begin();
+            writer.AppendPacked7Bit(dump.data(), dump.size());
+            writer.End();
+
+            Message msg;
+            msg.BeginSysEx().AppendPacked7Bit(dump.data(), dump.size()).EndSysEx();
+            EXPECT_EQ(streamed, std::vector<uint8_t>(msg.Buffer(), msg.Buffer() + msg.size()));
+        }
+
+    #endif
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
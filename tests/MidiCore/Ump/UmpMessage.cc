@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Ump/UmpMessage.h>
+#include <MidiCore/Protocol/Defines.h>
+#include <type_traits>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Compile Time Checks
+
+        static_assert(std::is_trivially_copyable<UmpMessage>::value, "UmpMessage must be trivially copyable");
+        static_assert(sizeof(UmpMessage) == 4 * sizeof(uint32_t), "UmpMessage must hold four words");
+
+        static_assert(UmpMessage::FromShortMessage(ShortMessage::NoteOn(60, 100, 2), 3).Word(0) == 0x23923C64, "constexpr Channel Voice");
+        static_assert(UmpMessage::FromShortMessage(ShortMessage::TimingTick(), 15).Word(0) == 0x1FF80000, "constexpr Real-Time");
+        static_assert(UmpMessage::FromShortMessage(ShortMessage()).Word(0) == 0, "empty message is a NOOP");
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Packets
+
+        TEST(UmpMessage, WordCountFollowsMessageType) {
+            const size_t expected[16] = {1, 1, 1, 2, 2, 4, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4};
+            for (uint32_t type = 0; type < 16; type++) {
+                EXPECT_EQ(UmpMessage::WordCount(type << 28), expected[type]) << "Message Type " << type;
+            }
+
+            // Words beyond the packet size are cleared
+            UmpMessage packet(0x20903C64, 1, 2, 3);
+            EXPECT_EQ(packet.WordCount(), 1u);
+            EXPECT_EQ(packet, UmpMessage(0x20903C64));
+
+            const uint32_t words[] = {0x40903C00, 0xFFFF0000, 7, 7};
+            EXPECT_EQ(UmpMessage::FromWords(words), UmpMessage(0x40903C00, 0xFFFF0000));
+        }
+
+        TEST(UmpMessage, ShortMessageRoundTrip) {
+            const ShortMessage messages[] = {
+                ShortMessage::NoteOff(60, 0, 15), ShortMessage::ProgramChange(5, 1), ShortMessage::PitchBend(static_cast<uint16_t>(0x2345), 9),
+                ShortMessage::MTC_QuarterFrame(3, 9), ShortMessage::SongPositionPointer(1000), ShortMessage::TuningRequest(), ShortMessage::Stop()};
+
+            for (const ShortMessage& message : messages) {
+                UmpMessage packet = UmpMessage::FromShortMessage(message, 7);
+                EXPECT_EQ(packet.Group(), 7u);
+                EXPECT_EQ(packet.Type(), (message.Status() >= 0xF0) ? UmpType::System : UmpType::Midi1ChannelVoice);
+                EXPECT_EQ(packet.ToShortMessage(), message);
+            }
+
+            // Other packet types have no MIDI 1.0 equivalent
+            EXPECT_EQ(UmpMessage(0x40903C00, 0xFFFF0000).ToShortMessage(), ShortMessage());
+        }
+
+        TEST(UmpMessage, SysEx7Packets) {
+            const uint8_t data[] = {0x7E, 0x7F, 0x06, 0x01, 0x55, 0x66, 0x77};
+            UmpMessage packet = UmpMessage::SysEx7(4, UmpSysExStatus::Start, data, sizeof(data));
+
+            EXPECT_EQ(packet.Word(0), 0x34167E7Fu);
+            EXPECT_EQ(packet.Word(1), 0x06015566u);
+            EXPECT_EQ(packet.Type(), UmpType::Data64);
+            EXPECT_EQ(packet.SysExStatus(), UmpSysExStatus::Start);
+            ASSERT_EQ(packet.SysExSize(), 6u);
+            for (size_t i = 0; i < 6; i++) {
+                EXPECT_EQ(packet.SysExData(i), data[i]);
+            }
+            EXPECT_EQ(packet.SysExData(6), 0);
+
+            UmpMessage last = UmpMessage::SysEx7(4, UmpSysExStatus::End, data + 6, 1);
+            EXPECT_EQ(last.Word(0), 0x34317700u);
+            EXPECT_EQ(last.Word(1), 0u);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <MidiCore/Ump/UmpTranslator.h>
+#include <vector>
+#include <cstdint>
+
+namespace MIDILAR::MidiCore {
+
+    namespace {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+
+        using Words = std::vector<uint32_t>;
+        using Bytes = std::vector<uint8_t>;
+
+        Words ToUmp(const Bytes& message, uint8_t group) {
+            Words words(UmpTranslator::EncodedSize(message.size()));
+            words.resize(UmpTranslator::ToUmp(message.data(), message.size(), group, words.data()));
+            return words;
+        }
+
+        Words ToUmp(const Bytes& chunk, MessageParser::SysExChunk position) {
+            Words words(UmpTranslator::EncodedSize(chunk.size()));
+            words.resize(UmpTranslator::ToUmp(chunk.data(), chunk.size(), position, 0, words.data()));
+            return words;
+        }
+
+        Bytes ToBytes(UmpTranslator& translator, const Words& words, uint8_t group) {
+            Bytes bytes(UmpTranslator::DecodedSize(words.size()));
+            bytes.resize(translator.ToBytes(words.data(), words.size(), group, bytes.data()));
+            return bytes;
+        }
+
+        Words g_BatchWords;
+
+        void TranslateBatch(const MessageParser::Batch& batch) {
+            size_t start = g_BatchWords.size();
+            g_BatchWords.resize(start + UmpTranslator::EncodedSize(batch.ByteSize()));
+            g_BatchWords.resize(start + UmpTranslator::ToUmp(batch, 2, g_BatchWords.data() + start));
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // To UMP
+
+        TEST(UmpTranslator, MessagesToUmp) {
+            EXPECT_EQ(ToUmp({0x93, 60, 100}, 5), (Words{0x25933C64}));
+            EXPECT_EQ(ToUmp({0xC1, 7}, 0), (Words{0x20C10700}));
+            EXPECT_EQ(ToUmp({0xF2, 0x10, 0x20}, 15), (Words{0x1FF21020}));
+            EXPECT_EQ(ToUmp({0xF6}, 1), (Words{0x11F60000}));
+            EXPECT_EQ(ToUmp({0xF8}, 1), (Words{0x11F80000}));
+
+            // Data bytes, undefined status bytes and truncated messages produce nothing
+            EXPECT_TRUE(ToUmp({60, 100}, 0).empty());
+            EXPECT_TRUE(ToUmp({0xF4}, 0).empty());
+            EXPECT_TRUE(ToUmp({0x90, 60}, 0).empty());
+        }
+
+        TEST(UmpTranslator, SysExToPackets) {
+            EXPECT_EQ(ToUmp({0xF0, 0xF7}, 0), (Words{0x30000000, 0}));
+            EXPECT_EQ(ToUmp({0xF0, 1, 2, 3, 0xF7}, 0), (Words{0x30030102, 0x03000000}));
+            EXPECT_EQ(ToUmp({0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 0xF7}, 3), (Words{
+                0x33160102, 0x03040506,
+                0x33320708, 0x00000000}));
+            EXPECT_EQ(ToUmp({0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0xF7}, 0), (Words{
+                0x30160102, 0x03040506,
+                0x30260708, 0x090A0B0C,
+                0x30310D00, 0x00000000}));
+        }
+
+        TEST(UmpTranslator, SysExChunksToPackets) {
+            EXPECT_EQ(ToUmp({0xF0, 1, 2}, MessageParser::SysExChunk::Start), (Words{0x30120102, 0}));
+            EXPECT_EQ(ToUmp({3}, MessageParser::SysExChunk::Continue), (Words{0x30210300, 0}));
+            EXPECT_EQ(ToUmp({4, 0xF7}, MessageParser::SysExChunk::End), (Words{0x30310400, 0}));
+            EXPECT_EQ(ToUmp({0xF7}, MessageParser::SysExChunk::End), (Words{0x30300000, 0}));
+            EXPECT_EQ(ToUmp({0xF0, 5, 0xF7}, MessageParser::SysExChunk::Complete), (Words{0x30010500, 0}));
+
+            EXPECT_TRUE(ToUmp({}, MessageParser::SysExChunk::Continue).empty());
+            EXPECT_TRUE(ToUmp({}, MessageParser::SysExChunk::Abort).empty());
+        }
+
+        TEST(UmpTranslator, BatchToUmp) {
+            MessageParser parser(32);
+            parser.SetRunningStatus(true);
+            MessageParser::StaticBatch<16, 64> batch;
+            g_BatchWords.clear();
+            parser.BindBatchCallback(TranslateBatch, batch);
+
+            const uint8_t stream[] = {0x90, 60, 100, 62, 0xF8, 100, 0xF0, 1, 2, 0xF7, 0xF6, 0xC0, 5};
+            parser.ProcessData(stream, sizeof(stream));
+            EXPECT_EQ(g_BatchWords, (Words{
+                0x22903C64, 0x12F80000, 0x22903E64, 0x32020102, 0x00000000, 0x12F60000, 0x22C00500}));
+        }
+
+        TEST(UmpTranslator, ShortMessageArray) {
+            const ShortMessage messages[] = {
+                ShortMessage::NoteOn(60, 100, 3), ShortMessage(), ShortMessage::TimingTick(), ShortMessage::SongSelect(4),
+                ShortMessage::PitchBend(static_cast<uint16_t>(0x3FFF), 15), ShortMessage::TuningRequest(), ShortMessage::CC_Volume(90, 1),
+                ShortMessage::ChannelPressure(12), ShortMessage::Start()};
+            const size_t count = sizeof(messages) / sizeof(messages[0]);
+
+            uint32_t words[count];
+            UmpTranslator::ToUmp(messages, count, 9, words);
+            for (size_t i = 0; i < count; i++) {
+                EXPECT_EQ(words[i], UmpMessage::FromShortMessage(messages[i], 9).Word(0)) << "Message " << i;
+            }
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // To Bytes
+
+        TEST(UmpTranslator, ToBytesWithRunningStatus) {
+            UmpTranslator translator;
+            EXPECT_FALSE(translator.RunningStatusEnabled());
+            translator.SetRunningStatus(true);
+            const Words words = {
+                0x20903C64, 0x21913C64, 0x10F80000, 0x20903E64, 0x20803C00, 0x20803E00,
+                0x40903C00, 0xFFFF0000, // MIDI 2.0 Channel Voice, skipped
+                0x10F30100, 0x20803E00};
+
+            EXPECT_EQ(ToBytes(translator, words, 0), (Bytes{
+                0x90, 60, 100, 0xF8, 62, 100, 0x80, 60, 0, 62, 0, 0xF3, 1, 0x80, 62, 0}));
+            EXPECT_EQ(ToBytes(translator, words, 1), (Bytes{0x91, 60, 100}));
+
+            // Running status carries over to the next call of the same group
+            EXPECT_EQ(ToBytes(translator, {0x20803C00}, 0), (Bytes{60, 0}));
+            translator.Reset();
+            EXPECT_EQ(ToBytes(translator, {0x20803C00}, 0), (Bytes{0x80, 60, 0}));
+
+            translator.SetRunningStatus(false);
+            EXPECT_EQ(ToBytes(translator, {0x20803C00, 0x20803E00}, 0), (Bytes{0x80, 60, 0, 0x80, 62, 0}));
+        }
+
+        TEST(UmpTranslator, ToBytesSysEx) {
+            UmpTranslator translator;
+            const Words words = {
+                0x20903C64,
+                0x30160102, 0x03040506,
+                0x31010900, 0x00000000, // Other group
+                0x30260708, 0x090A0B0C,
+                0x30310D00, 0x00000000,
+                0x20903E64,
+                0x30000000}; // Truncated
+
+            EXPECT_EQ(ToBytes(translator, words, 0), (Bytes{
+                0x90, 60, 100, 0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0xF7, 0x90, 62, 100}));
+            EXPECT_EQ(ToBytes(translator, words, 1), (Bytes{0xF0, 9, 0xF7}));
+        }
+
+        TEST(UmpTranslator, RoundTrip) {
+            const Bytes stream = {0xB0, 7, 100, 10, 64, 0xF8, 0xF0, 0x7E, 0x7F, 0x06, 0x01, 0xF7, 0xE0, 0, 64, 0xF1, 0x23, 0xE0, 1, 64, 2, 64};
+            MessageParser parser(32);
+            parser.SetRunningStatus(true);
+            MessageParser::StaticBatch<16, 64> batch;
+            g_BatchWords.clear();
+            parser.BindBatchCallback(TranslateBatch, batch);
+            parser.ProcessData(stream.data(), stream.size());
+
+            UmpTranslator translator;
+            translator.SetRunningStatus(true);
+            EXPECT_EQ(ToBytes(translator, g_BatchWords, 2), stream);
+        }
+    //
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
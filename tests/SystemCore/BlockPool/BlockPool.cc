@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <SystemCore/BlockPool/BlockPool.h>
+
+#include <thread>
+#include <vector>
+#include <set>
+#include <cstring>
+
+using MIDILAR::SystemCore::BlockPool;
+
+namespace {
+
+TEST(BlockPool, AllocatesEveryBlockOnce) {
+    BlockPool<16, 8> pool;
+    std::set<void*> blocks;
+
+    for (size_t i = 0; i < 8; i++) {
+        void* block = pool.Allocate();
+        ASSERT_NE(block, nullptr);
+        EXPECT_TRUE(pool.Owns(block));
+        EXPECT_TRUE(blocks.insert(block).second);
+        std::memset(block, 0xAA, 16);
+    }
+
+    EXPECT_EQ(pool.Allocate(), nullptr);
+    EXPECT_EQ(pool.InUse(), 8u);
+    EXPECT_EQ(pool.FailedAllocations(), 1u);
+}
+
+TEST(BlockPool, DeallocateReusesBlocks) {
+    BlockPool<4, 2> pool;
+    void* a = pool.Allocate();
+    void* b = pool.Allocate();
+
+    EXPECT_TRUE(pool.Deallocate(a));
+    EXPECT_EQ(pool.InUse(), 1u);
+    EXPECT_EQ(pool.Allocate(), a);
+
+    EXPECT_TRUE(pool.Deallocate(a));
+    EXPECT_TRUE(pool.Deallocate(b));
+    EXPECT_EQ(pool.InUse(), 0u);
+}
+
+TEST(BlockPool, RejectsForeignPointers) {
+    BlockPool<16, 4> pool;
+    uint8_t outside[16];
+    uint8_t* block = static_cast<uint8_t*>(pool.Allocate());
+
+    EXPECT_FALSE(pool.Owns(outside));
+    EXPECT_FALSE(pool.Deallocate(outside));
+    EXPECT_FALSE(pool.Deallocate(block + 1));
+    EXPECT_FALSE(pool.Deallocate(nullptr));
+    EXPECT_EQ(pool.InUse(), 1u);
+}
+
+TEST(BlockPool, StatisticsTrackHighWaterMark) {
+    BlockPool<16, 4> pool;
+    void* blocks[4];
+
+    for (void*& block : blocks) {
+        block = pool.Allocate();
+    }
+    for (void* block : blocks) {
+        pool.Deallocate(block);
+    }
+    pool.Allocate();
+
+    EXPECT_EQ(pool.InUse(), 1u);
+    EXPECT_EQ(pool.HighWaterMark(), 4u);
+
+    pool.ResetStatistics();
+    EXPECT_EQ(pool.HighWaterMark(), 1u);
+    EXPECT_EQ(pool.FailedAllocations(), 0u);
+}
+
+TEST(BlockPool, ConcurrentAllocateAndRelease) {
+    static BlockPool<16, 64> pool;
+    constexpr size_t threads = 4;
+    constexpr size_t rounds = 20000;
+    std::vector<std::thread> workers;
+    bool corrupted = false;
+
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([t, &corrupted]() {
+            for (size_t i = 0; i < rounds; i++) {
+                uint8_t* block = static_cast<uint8_t*>(pool.Allocate());
+                if (block == nullptr) {
+                    continue;
+                }
+
+                // A block handed out twice would be overwritten by another thread
+                std::memset(block, static_cast<int>(t), 16);
+                for (size_t k = 0; k < 16; k++) {
+                    if (block[k] != t) {
+                        corrupted = true;
+                    }
+                }
+                pool.Deallocate(block);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_FALSE(corrupted);
+    EXPECT_EQ(pool.InUse(), 0u);
+    EXPECT_LE(pool.HighWaterMark(), threads);
+}
+
+}
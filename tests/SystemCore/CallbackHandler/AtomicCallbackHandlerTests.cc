@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <SystemCore/CallbackHandler/AtomicCallbackHandler.h>
+#include <atomic>
+#include <thread>
+
+using MIDILAR::SystemCore::AtomicCallbackHandler;
+
+namespace {
+
+int Double(int value) {
+    return value * 2;
+}
+
+int Triple(int value) {
+    return value * 3;
+}
+
+class Offset {
+public:
+    int base;
+
+    int Add(int value) {
+        return base + value;
+    }
+};
+
+int g_NoArgs = 0;
+
+void CountNoArgs() {
+    g_NoArgs++;
+}
+
+} // namespace
+
+TEST(AtomicCallbackHandlerTest, BindsEveryTargetKind) {
+    AtomicCallbackHandler<int, int> handler;
+    EXPECT_FALSE(handler.status());
+
+    handler.bind(&Double);
+    EXPECT_TRUE(handler.status());
+    EXPECT_EQ(handler.invoke(4), 8);
+
+    Offset offset{100};
+    handler.bind<Offset, &Offset::Add>(&offset);
+    EXPECT_EQ(handler.invoke(4), 104);
+
+    int factor = 5;
+    handler.bind([factor](int value) { return value * factor; });
+    EXPECT_EQ(handler.invoke(4), 20);
+
+    handler.unbind();
+    EXPECT_FALSE(handler.status());
+
+    handler.bind(&Triple);
+    handler.bind(nullptr);
+    EXPECT_FALSE(handler.status());
+}
+
+TEST(AtomicCallbackHandlerTest, VoidSpecialisationTakesNoArguments) {
+    AtomicCallbackHandler<void, void> handler;
+    g_NoArgs = 0;
+    handler.bind(&CountNoArgs);
+    handler.invoke();
+    handler.invoke();
+    EXPECT_EQ(g_NoArgs, 2);
+}
+
+TEST(AtomicCallbackHandlerTest, QuiescentWithoutRunningInvocations) {
+    AtomicCallbackHandler<int, int> handler;
+    EXPECT_TRUE(handler.quiescent());
+
+    handler.bind(&Double);
+    EXPECT_TRUE(handler.quiescent());
+    handler.bind(&Triple);
+    EXPECT_TRUE(handler.quiescent());
+    handler.synchronize();
+}
+
+TEST(AtomicCallbackHandlerTest, InvokeBindsToSingleTargetApis) {
+    AtomicCallbackHandler<int, int> inner;
+    MIDILAR::SystemCore::CallbackHandler<int, int> outer;
+    outer.bind<AtomicCallbackHandler<int, int>, &AtomicCallbackHandler<int, int>::invoke>(&inner);
+
+    inner.bind(&Double);
+    EXPECT_EQ(outer.invoke(3), 6);
+    inner.bind(&Triple);
+    EXPECT_EQ(outer.invoke(3), 9);
+}
+
+TEST(AtomicCallbackHandlerTest, ReplacedTargetIsTrackedUntilItReturns) {
+    static std::atomic<bool> entered;
+    static std::atomic<bool> release;
+    entered.store(false);
+    release.store(false);
+
+    AtomicCallbackHandler<int, int> handler;
+    handler.bind([](int value) {
+        entered.store(true);
+        while (!release.load()) {
+        }
+        return value;
+    });
+
+    int result = 0;
+    std::thread reader([&] { result = handler.invoke(7); });
+    while (!entered.load()) {
+    }
+
+    // The reader still runs the first target
+    handler.bind(&Double);
+    EXPECT_FALSE(handler.quiescent());
+    EXPECT_EQ(handler.invoke(7), 14);
+    EXPECT_FALSE(handler.quiescent());
+
+    release.store(true);
+    reader.join();
+    handler.synchronize();
+    EXPECT_TRUE(handler.quiescent());
+    EXPECT_EQ(result, 7);
+}
+
+TEST(AtomicCallbackHandlerTest, ConcurrentRebindingNeverTearsTheTarget) {
+    // Every target returns a value tied to its own instance: a torn invoker/instance pair shows up
+    // as a result none of them returns
+    Offset low{1000};
+    Offset high{2000};
+
+    AtomicCallbackHandler<int, int> handler;
+    handler.bind<Offset, &Offset::Add>(&low);
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> calls{0};
+
+    auto reader = [&] {
+        while (!stop.load()) {
+            int value = handler.invoke(1);
+            if (value != 1001 && value != 2001 && value != 2 && value != 3) {
+                torn.fetch_add(1);
+            }
+            calls.fetch_add(1);
+        }
+    };
+
+    std::thread first(reader);
+    std::thread second(reader);
+    while (calls.load() == 0) {
+    }
+
+    for (int i = 0; i < 20000; i++) {
+        switch (i & 3) {
+            case 0: handler.bind<Offset, &Offset::Add>(&high); break;
+            case 1: handler.bind(&Double); break;
+            case 2: handler.bind<Offset, &Offset::Add>(&low); break;
+            default: handler.bind(&Triple); break;
+        }
+    }
+    handler.synchronize();
+
+    stop.store(true);
+    first.join();
+    second.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_GT(calls.load(), 0);
+}
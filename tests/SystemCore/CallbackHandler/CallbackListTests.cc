@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <SystemCore/CallbackHandler/CallbackHandler.h>
+#include <SystemCore/CallbackHandler/CallbackList.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using MIDILAR::SystemCore::CallbackHandler;
+using MIDILAR::SystemCore::CallbackList;
+
+namespace {
+
+std::vector<int> g_Calls;
+
+void RecordFirst(int value) {
+    g_Calls.push_back(value);
+}
+
+void RecordSecond(int value) {
+    g_Calls.push_back(value * 10);
+}
+
+class Accumulator {
+public:
+    int total = 0;
+    int calls = 0;
+
+    void Add(int value) {
+        total += value;
+        calls++;
+    }
+
+    void Subtract(int value) {
+        total -= value;
+    }
+};
+
+int g_NoArgs = 0;
+
+void CountNoArgs() {
+    g_NoArgs++;
+}
+
+} // namespace
+
+TEST(CallbackListTest, StartsEmpty) {
+    CallbackList<4, void, int> list;
+    EXPECT_FALSE(list.status());
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(list.capacity(), 4u);
+
+    list.invoke(1); // Nothing bound, nothing happens
+}
+
+TEST(CallbackListTest, InvokesEveryTargetInOrder) {
+    CallbackList<4, void, int> list;
+    Accumulator first, second;
+    g_Calls.clear();
+
+    EXPECT_TRUE(list.bind(&RecordFirst));
+    EXPECT_TRUE((list.bind<Accumulator, &Accumulator::Add>(&first)));
+    EXPECT_TRUE(list.bind(&RecordSecond));
+    EXPECT_TRUE((list.bind<Accumulator, &Accumulator::Add>(&second)));
+    EXPECT_EQ(list.size(), 4u);
+
+    list.invoke(3);
+    list.invoke(4);
+    EXPECT_EQ(g_Calls, (std::vector<int>{3, 30, 4, 40}));
+    EXPECT_EQ(first.total, 7);
+    EXPECT_EQ(second.total, 7);
+}
+
+TEST(CallbackListTest, BindingIsIdempotentAndBounded) {
+    CallbackList<2, void, int> list;
+    Accumulator acc;
+
+    EXPECT_TRUE((list.bind<Accumulator, &Accumulator::Add>(&acc)));
+    EXPECT_TRUE((list.bind<Accumulator, &Accumulator::Add>(&acc)));
+    EXPECT_EQ(list.size(), 1u);
+
+    // Another method of the same instance is a different target
+    EXPECT_TRUE((list.bind<Accumulator, &Accumulator::Subtract>(&acc)));
+    EXPECT_FALSE(list.bind(&RecordFirst));
+    EXPECT_FALSE(list.bind(nullptr));
+
+    list.invoke(5);
+    EXPECT_EQ(acc.total, 0);
+    EXPECT_EQ(acc.calls, 1);
+}
+
+TEST(CallbackListTest, UnbindFreesSlots) {
+    CallbackList<2, void, int> list;
+    Accumulator acc;
+    g_Calls.clear();
+
+    list.bind(&RecordFirst);
+    list.bind<Accumulator, &Accumulator::Add>(&acc);
+    EXPECT_TRUE(list.unbind(&RecordFirst));
+    EXPECT_FALSE(list.unbind(&RecordFirst));
+    EXPECT_FALSE((list.unbind<Accumulator, &Accumulator::Subtract>(&acc)));
+
+    list.invoke(2);
+    EXPECT_TRUE(g_Calls.empty());
+    EXPECT_EQ(acc.total, 2);
+
+    // The freed slot is reused
+    EXPECT_TRUE(list.bind(&RecordSecond));
+    list.invoke(1);
+    EXPECT_EQ(g_Calls, (std::vector<int>{10}));
+
+    list.unbind();
+    EXPECT_FALSE(list.status());
+    list.invoke(1);
+    EXPECT_EQ(acc.total, 3);
+}
+
+TEST(CallbackListTest, NoArgumentCallbacks) {
+    CallbackList<2, void> list;
+    g_NoArgs = 0;
+
+    list.bind(&CountNoArgs);
+    list.invoke();
+    list.invoke();
+    EXPECT_EQ(g_NoArgs, 2);
+}
+
+TEST(CallbackListTest, BindsIntoCallbackHandler) {
+    using List = CallbackList<2, void, int>;
+    List list;
+    Accumulator first, second;
+    list.bind<Accumulator, &Accumulator::Add>(&first);
+    list.bind<Accumulator, &Accumulator::Add>(&second);
+
+    CallbackHandler<void, int> handler;
+    handler.bind<List, &List::invoke>(&list);
+    handler.invoke(6);
+    EXPECT_EQ(first.total, 6);
+    EXPECT_EQ(second.total, 6);
+}
+
+TEST(CallbackListTest, RebindingWhileInvoking) {
+    // Odd targets are bound through one method and even targets through another: a slot reused
+    // while an invocation still reads it would pair one target's trampoline with another's instance.
+    struct Target {
+        int id = 0;
+        std::atomic<int> calls{0};
+        std::atomic<int> errors{0};
+
+        void Odd(int) {
+            calls++;
+            errors += (id % 2 != 1);
+        }
+
+        void Even(int) {
+            calls++;
+            errors += (id % 2 != 0);
+        }
+    };
+
+    CallbackList<4, void, int> list;
+    Target targets[8];
+    for (int i = 0; i < 8; i++) {
+        targets[i].id = i + 1;
+    }
+
+    auto bind = [&](Target& target) {
+        return (target.id % 2) ? list.bind<Target, &Target::Odd>(&target) : list.bind<Target, &Target::Even>(&target);
+    };
+    auto unbind = [&](Target& target) {
+        return (target.id % 2) ? list.unbind<Target, &Target::Odd>(&target) : list.unbind<Target, &Target::Even>(&target);
+    };
+
+    std::atomic<bool> done{false};
+    std::thread rt([&] {
+        while (!done.load()) {
+            list.invoke(0);
+        }
+    });
+
+    for (int round = 0; round < 20000; round++) {
+        bind(targets[round % 8]);
+        if (round >= 2) {
+            unbind(targets[(round - 2) % 8]);
+        }
+    }
+    list.unbind();
+    list.synchronize();
+
+    int calls = 0;
+    for (Target& target : targets) {
+        calls += target.calls.load();
+    }
+    list.invoke(0); // Stopped reaching the targets once synchronized
+    done.store(true);
+    rt.join();
+
+    int after = 0;
+    for (Target& target : targets) {
+        EXPECT_EQ(target.errors.load(), 0);
+        after += target.calls.load();
+    }
+    EXPECT_EQ(after, calls);
+    EXPECT_FALSE(list.status());
+}
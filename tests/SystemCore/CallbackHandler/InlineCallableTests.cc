@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <SystemCore/CallbackHandler/CallbackHandler.h>
+#include <cstdint>
+
+using MIDILAR::SystemCore::CallbackHandler;
+
+namespace {
+
+struct Scaler {
+    int factor;
+    int offset;
+
+    int operator()(int value) const {
+        return value * factor + offset;
+    }
+};
+
+int g_LastPort = -1;
+int g_LastValue = 0;
+
+} // namespace
+
+TEST(InlineCallableTest, HandlerStaysSmall) {
+    EXPECT_EQ((CallbackHandler<int, int>::InlineSize), static_cast<size_t>(MIDILAR_CALLBACK_INLINE_SIZE));
+    EXPECT_LE(sizeof(CallbackHandler<void, const uint8_t*, size_t>), sizeof(void*) + MIDILAR_CALLBACK_INLINE_SIZE + alignof(double));
+}
+
+TEST(InlineCallableTest, BindsCapturingLambda) {
+    CallbackHandler<void, int> handler;
+    int port = 3;
+
+    handler.bind([port](int value) {
+        g_LastPort = port;
+        g_LastValue = value;
+    });
+    ASSERT_TRUE(handler.status());
+
+    port = 7; // The capture is a copy
+    handler.invoke(42);
+    EXPECT_EQ(g_LastPort, 3);
+    EXPECT_EQ(g_LastValue, 42);
+}
+
+TEST(InlineCallableTest, BindsFunctionObjectReturningValue) {
+    CallbackHandler<int, int> handler;
+    handler.bind(Scaler{3, 1});
+    EXPECT_EQ(handler.invoke(5), 16);
+
+    // Captures filling the whole buffer
+    int64_t a = 100, b = 20;
+    handler.bind([a, b](int value) { return static_cast<int>(a + b + value); });
+    EXPECT_EQ(handler.invoke(3), 123);
+}
+
+TEST(InlineCallableTest, CapturedPointerReachesState) {
+    CallbackHandler<void, void> handler;
+    int counter = 0;
+    int* target = &counter;
+
+    handler.bind([target]() { ++*target; });
+    handler.invoke();
+    handler.invoke();
+    EXPECT_EQ(counter, 2);
+}
+
+TEST(InlineCallableTest, RebindingAndUnbinding) {
+    CallbackHandler<int, int> handler;
+    handler.bind(Scaler{2, 0});
+    handler.bind([](int value) { return -value; });
+    EXPECT_EQ(handler.invoke(4), -4);
+
+    handler.bind(nullptr);
+    EXPECT_FALSE(handler.status());
+
+    handler.bind(Scaler{1, 1});
+    handler.unbind();
+    EXPECT_FALSE(handler.status());
+}